@@ -15,6 +15,7 @@
 // This file is a part of scnlib:
 //     https://github.com/eliaskosunen/scnlib
 
+#include <scn/parsed_format.h>
 #include <scn/scan.h>
 #include "benchmark_common.h"
 
@@ -54,6 +55,132 @@ static void bench_basic_scn_withoptions(benchmark::State& state)
 }
 BENCHMARK(bench_basic_scn_withoptions);
 
+static void bench_basic_scn_compiled(benchmark::State& state)
+{
+    std::string_view input{"123"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<int>(input, SCN_COMPILE("{}"))) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->value()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_compiled);
+
+static void bench_basic_scn_compiled_multiple(benchmark::State& state)
+{
+    std::string_view input{"123 456 789"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<int, int, int>(input, SCN_COMPILE("{} {} {}"))) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->values()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_compiled_multiple);
+
+static void bench_basic_scn_multiple(benchmark::State& state)
+{
+    std::string_view input{"123 456 789"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<int, int, int>(input, "{} {} {}")) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->values()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_multiple);
+
+static void bench_basic_scn_multiple_parsed(benchmark::State& state)
+{
+    std::string_view input{"123 456 789"};
+    auto format = scn::make_parsed_format<int, int, int>("{} {} {}");
+    if (!format) {
+        state.SkipWithError("Failed to parse format string");
+        return;
+    }
+    for (auto _ : state) {
+        if (auto result = scn::scan<int, int, int>(input, *format)) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->values()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_multiple_parsed);
+
+static void bench_basic_scn_columns(benchmark::State& state)
+{
+    std::string input{};
+    for (int i = 0; i < 1000; ++i) {
+        input += "123 456 789\n";
+    }
+    auto format = scn::make_parsed_format<int, int, int>("{} {} {}");
+    if (!format) {
+        state.SkipWithError("Failed to parse format string");
+        return;
+    }
+    std::vector<int> a, b, c;
+    for (auto _ : state) {
+        a.clear();
+        b.clear();
+        c.clear();
+        auto result = scn::scan_columns(input, *format, a, b, c);
+        if (!result || !result->errors.empty()) {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(bench_basic_scn_columns);
+
+static void bench_basic_scn_literal_prefixes(benchmark::State& state)
+{
+    std::string_view input{"timestamp=123 level=456 value=789"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<int, int, int>(
+                input, "timestamp={} level={} value={}")) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->values()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_literal_prefixes);
+
+static void bench_basic_scn_fixed_width_record(benchmark::State& state)
+{
+    std::string_view input{"0042ABCDEFGH123456WXYZ0000000789"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<int, std::string_view, int, std::string_view, int>(
+                    input, "{:.4}{:.8}{:.6}{:.4}{:.10}")) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->values()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_fixed_width_record);
+
 #if !SCN_DISABLE_LOCALE
 static void bench_basic_scn_withlocale(benchmark::State& state)
 {
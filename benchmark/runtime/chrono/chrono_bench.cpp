@@ -0,0 +1,268 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include <scn/chrono.h>
+#include <scn/scan.h>
+#include "benchmark_common.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+// Fixed-layout formats, read with the fast path from contiguous sources
+
+static void bench_chrono_rfc3339(benchmark::State& state)
+{
+    std::string_view input{"2024-08-23T23:06:10.123+02:00"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::datetime_components>(
+                input, "{:%Y-%m-%dT%H:%M:%.S%z}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_rfc3339);
+
+static void bench_chrono_iso8601_tm(benchmark::State& state)
+{
+    std::string_view input{"2024-08-23 23:06:10"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::tm>(input, "{:%F %T}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_iso8601_tm);
+
+static void bench_chrono_clf(benchmark::State& state)
+{
+    std::string_view input{"10/Oct/2000:13:55:36 -0700"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::tm_with_tz>(
+                input, "{:%d/%b/%Y:%H:%M:%S %z}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_clf);
+
+static void bench_chrono_syslog(benchmark::State& state)
+{
+    std::string_view input{"Oct 16 12:00:00"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<scn::datetime_components>(input, "{:%b %d %T}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_syslog);
+
+static void bench_chrono_tz_name(benchmark::State& state)
+{
+    std::string_view input{"Oct 16 12:00:00 CEST"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::datetime_components>(
+                input, "{:%b %d %T %Z}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_tz_name);
+
+// Directly into a sys_time, without a std::tm round-trip
+
+static void bench_chrono_sys_time(benchmark::State& state)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::milliseconds>;
+    std::string_view input{"2024-08-23T23:06:10.123+02:00"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<time_point>(input, "{:%Y-%m-%dT%H:%M:%.S%z}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_sys_time);
+
+static void bench_chrono_sys_time_epoch_seconds(benchmark::State& state)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::seconds>;
+    std::string_view input{"1724447170"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<time_point>(input, "{}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_sys_time_epoch_seconds);
+
+// Same format, from a non-contiguous source, which always uses the generic
+// parser, for comparison
+
+static void bench_chrono_rfc3339_deque(benchmark::State& state)
+{
+    std::string_view str{"2024-08-23T23:06:10.123+02:00"};
+    std::deque<char> input(str.begin(), str.end());
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::datetime_components>(
+                input, "{:%Y-%m-%dT%H:%M:%.S%z}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_rfc3339_deque);
+
+// A format with a field not handled by the fast path (%A)
+
+static void bench_chrono_generic(benchmark::State& state)
+{
+    std::string_view input{"Friday 2024-08-23"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<scn::datetime_components>(input, "{:%A %Y-%m-%d}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_generic);
+
+static void bench_chrono_full_month_name(benchmark::State& state)
+{
+    std::string_view input{"September 2024"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<scn::datetime_components>(input, "{:%B %Y}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_chrono_full_month_name);
+
+// Columns of timestamps: scan_chrono_batch, compared to scanning every
+// record with a separate scn::scan call
+
+namespace {
+std::string make_timestamp_column(std::size_t rows)
+{
+    std::string source;
+    for (std::size_t i = 0; i < rows; ++i) {
+        source += "2024-08-";
+        source += static_cast<char>('1' + i % 2);
+        source += static_cast<char>('0' + i % 10);
+        source += "T23:06:10.";
+        source += std::to_string(100 + i % 900);
+        source += "+02:00\n";
+    }
+    return source;
+}
+}  // namespace
+
+static void bench_chrono_batch(benchmark::State& state)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::milliseconds>;
+    const auto source =
+        make_timestamp_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<time_point> column;
+    for (auto _ : state) {
+        column.clear();
+        if (auto result = scn::scan_chrono_batch(
+                source, "%Y-%m-%dT%H:%M:%.S%z", column)) {
+            benchmark::DoNotOptimize(column.data());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(source.size()));
+}
+BENCHMARK(bench_chrono_batch)->Arg(1024)->Arg(65536);
+
+static void bench_chrono_per_record(benchmark::State& state)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::milliseconds>;
+    const auto source =
+        make_timestamp_column(static_cast<std::size_t>(state.range(0)));
+    std::vector<time_point> column;
+    for (auto _ : state) {
+        column.clear();
+        auto input = scn::ranges::subrange{source.data(),
+                                           source.data() + source.size()};
+        while (!input.empty()) {
+            auto result =
+                scn::scan<time_point>(input, "{:%Y-%m-%dT%H:%M:%.S%z}\n");
+            if (!result) {
+                state.SkipWithError("Failed scan");
+                break;
+            }
+            column.push_back(result->value());
+            input = result->range();
+        }
+        benchmark::DoNotOptimize(column.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(source.size()));
+}
+BENCHMARK(bench_chrono_per_record)->Arg(1024)->Arg(65536);
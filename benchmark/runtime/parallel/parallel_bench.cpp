@@ -0,0 +1,95 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include <scn/parallel.h>
+#include <scn/scan.h>
+#include "benchmark_common.h"
+
+#include <string>
+#include <vector>
+
+// About 16 MiB of "<id> <value>" records, scanned with 1 to 32 threads
+
+static const std::string& get_parallel_input()
+{
+    static const std::string input = [] {
+        std::string str;
+        std::size_t i = 0;
+        while (str.size() < 16 * 1024 * 1024) {
+            str += std::to_string(i * 7919);
+            str += ' ';
+            str += std::to_string(static_cast<double>(i) * 0.25);
+            str += '\n';
+            ++i;
+        }
+        return str;
+    }();
+    return input;
+}
+
+static void bench_parallel_scan_columns(benchmark::State& state)
+{
+    const auto& input = get_parallel_input();
+    auto fmt = scn::make_parsed_format<long long, double>("{} {}");
+    const auto options = scn::scan_parallel_options{
+        static_cast<std::size_t>(state.range(0)), 0};
+
+    for (auto _ : state) {
+        std::vector<long long> ids;
+        std::vector<double> values;
+        if (auto result =
+                scn::scan_columns_parallel(options, input, *fmt, ids, values);
+            result && result->errors.empty()) {
+            benchmark::DoNotOptimize(ids.data());
+            benchmark::DoNotOptimize(values.data());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(bench_parallel_scan_columns)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+
+static void bench_parallel_for_each_line(benchmark::State& state)
+{
+    const auto& input = get_parallel_input();
+    const auto options = scn::scan_parallel_options{
+        static_cast<std::size_t>(state.range(0)), 0};
+
+    for (auto _ : state) {
+        scn::for_each_line_parallel(
+            input,
+            [](std::string_view line) {
+                if (auto result = scn::scan<long long>(line, "{}")) {
+                    benchmark::DoNotOptimize(result->value());
+                }
+            },
+            options);
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+BENCHMARK(bench_parallel_for_each_line)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
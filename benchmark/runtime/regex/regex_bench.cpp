@@ -0,0 +1,132 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include <scn/regex.h>
+#include <scn/scan.h>
+#include "benchmark_common.h"
+
+#include <regex>
+
+static void bench_regex_string_view(benchmark::State& state)
+{
+    std::string_view input{"foobar123"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<std::string_view>(input, "{:/[a-z]+[0-9]+/}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_string_view);
+
+static void bench_regex_matches(benchmark::State& state)
+{
+    std::string_view input{"foobar123"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::regex_matches>(
+                input, "{:/([a-z]+)([0-9]+)/}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_matches);
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+static void bench_regex_ref_string_view(benchmark::State& state)
+{
+    const auto re = std::regex{"[a-z]+[0-9]+", std::regex::nosubs};
+    std::string_view input{"foobar123"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::regex_ref<std::string_view>>(
+                input, "{}", {scn::regex_ref<std::string_view>{re}})) {
+            benchmark::DoNotOptimize(result->value().value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_ref_string_view);
+#endif
+
+static void bench_regex_string_view_compiled(benchmark::State& state)
+{
+    std::string_view input{"foobar123"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::string_view>(
+                input, SCN_COMPILE("{:/[a-z]+[0-9]+/}"))) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_string_view_compiled);
+
+// Cycles through more patterns than fit in the regex cache,
+// so that every scan has to compile its regex
+static void bench_regex_string_view_many_patterns(benchmark::State& state)
+{
+    std::vector<std::string> patterns{};
+    for (int n = 1; n <= 64; ++n) {
+        patterns.push_back("{:/[a-z]+[0-9]{0," + std::to_string(n) + "}/}");
+    }
+
+    std::string_view input{"foobar123"};
+    std::size_t i = 0;
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::string_view>(
+                input, scn::runtime_format(patterns[i]))) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+        i = (i + 1) % patterns.size();
+    }
+}
+BENCHMARK(bench_regex_string_view_many_patterns);
+
+static void bench_regex_std_compile_and_match(benchmark::State& state)
+{
+    std::string_view input{"foobar123"};
+    for (auto _ : state) {
+        std::regex re{"[a-z]+[0-9]+", std::regex_constants::nosubs};
+        std::match_results<std::string_view::iterator> matches{};
+        if (std::regex_search(input.begin(), input.end(), matches, re,
+                              std::regex_constants::match_continuous)) {
+            benchmark::DoNotOptimize(matches.length(0));
+        }
+        else {
+            state.SkipWithError("Failed match");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_std_compile_and_match);
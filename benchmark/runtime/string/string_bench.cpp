@@ -65,6 +65,54 @@ BENCHMARK(bench_string_scn<wchar_t, std::wstring, unicode_tag>);
 BENCHMARK(bench_string_scn<wchar_t, std::wstring_view, lipsum_tag>);
 BENCHMARK(bench_string_scn<wchar_t, std::wstring_view, unicode_tag>);
 
+template <typename Tag>
+static void bench_validate_unicode_scalar(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char, Tag>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            scn::impl::validate_unicode_scalar(std::string_view{input}));
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+
+BENCHMARK(bench_validate_unicode_scalar<lipsum_tag>);
+BENCHMARK(bench_validate_unicode_scalar<unicode_tag>);
+
+template <typename Tag>
+static void bench_validate_unicode_fast(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char, Tag>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            scn::impl::validate_utf8_fast(std::string_view{input}));
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+
+BENCHMARK(bench_validate_unicode_fast<lipsum_tag>);
+BENCHMARK(bench_validate_unicode_fast<unicode_tag>);
+
+template <typename Tag>
+static void bench_text_width(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char32_t, Tag>();
+    for (auto _ : state) {
+        std::size_t width{0};
+        for (auto cp : input) {
+            width += scn::impl::calculate_text_width(cp);
+        }
+        benchmark::DoNotOptimize(width);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(input.size()));
+}
+
+BENCHMARK(bench_text_width<lipsum_tag>);
+BENCHMARK(bench_text_width<unicode_tag>);
+
 template <typename SourceCharT, typename DestStringT, typename Tag>
 static void bench_string_scn_value(benchmark::State& state)
 {
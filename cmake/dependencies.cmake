@@ -7,6 +7,12 @@ if (CMAKE_FIND_PACKAGE_SORT_ORDER)
 endif ()
 set(CMAKE_FIND_PACKAGE_SORT_ORDER NATURAL)
 
+# Threads, for the tests and benchmarks of <scn/parallel.h>
+
+if ((SCN_TESTS OR SCN_BENCHMARKS) AND (NOT TARGET Threads::Threads))
+    find_package(Threads REQUIRED)
+endif ()
+
 if (SCN_TESTS)
     # GTest
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <scn/columns.h>
 #include <scn/scan.h>
 
 #if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
@@ -24,6 +25,7 @@ import std;
 #include <time.h>
 #else
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #endif
 
@@ -298,7 +300,9 @@ struct datetime_components {
     std::optional<weekday> wday;
     /// Day of year (offset from Jan 1st), [0-365]
     std::optional<short> yday;
-    /// Timezone offset from UTC
+    /// Timezone offset from UTC.
+    /// Also set from `tz_name`, if it's resolved by the
+    /// `tz_abbreviation_resolver` in use.
     std::optional<std::chrono::minutes> tz_offset;
     /// Timezone name
     std::optional<std::string> tz_name;
@@ -334,10 +338,45 @@ struct datetime_components {
 };
 
 struct tm_with_tz : public std::tm {
+    /// Also set from `tz_name`, like in `datetime_components`
     std::optional<std::chrono::minutes> tz_offset;
     std::optional<std::string> tz_name;
 };
 
+/**
+ * A function resolving a time zone name, as read with `%Z`
+ * (like `"UTC"` or `"CET"`), into an offset from UTC.
+ * Returns `std::nullopt`, if the name is unknown.
+ */
+using tz_abbreviation_resolver =
+    std::optional<std::chrono::minutes> (*)(std::string_view);
+
+/**
+ * The default `tz_abbreviation_resolver`:
+ * looks up `name` in a static table of common time zone abbreviations,
+ * like `UTC`, `GMT`, `Z`, `CET`, `CEST`, `JST`, or `PST`.
+ * `EST`, `CST`, `MST`, and `PST` (and their daylight saving time
+ * counterparts) have their North American meanings, like in RFC 5322.
+ * Abbreviations with several common meanings, like `IST`, `AST`
+ * (Atlantic or Arabia), or `BST` (British or Bangladesh), are not included.
+ */
+SCN_PUBLIC std::optional<std::chrono::minutes> resolve_common_tz_abbreviation(
+    std::string_view name);
+
+/**
+ * Sets the resolver used with `%Z`, for all threads,
+ * and returns the previous one.
+ * If the resolver is `nullptr`, only `tz_name` is set.
+ *
+ * The resolver can be called from multiple threads at once:
+ * if it caches its results, it needs to do its own synchronization.
+ */
+SCN_PUBLIC tz_abbreviation_resolver
+set_tz_abbreviation_resolver(tz_abbreviation_resolver resolver);
+
+/// Returns the resolver used with `%Z`
+SCN_PUBLIC tz_abbreviation_resolver get_tz_abbreviation_resolver();
+
 namespace detail {
 enum class numeric_system {
     standard,
@@ -345,37 +384,172 @@ enum class numeric_system {
     alternative_o,  // 'O'
 };
 
+/**
+ * Days since 1970-01-01 of the date `y`-`m`-`d`, in the proleptic Gregorian
+ * calendar. Branch-light, and valid for every `int` year; see Howard Hinnant,
+ * "chrono-Compatible Low-Level Date Algorithms" (`days_from_civil`).
+ */
+constexpr std::int64_t days_from_civil(std::int64_t y, unsigned m, unsigned d)
+{
+    y -= static_cast<std::int64_t>(m <= 2);
+    const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const auto yoe = static_cast<unsigned>(y - era * 400);             // [0, 399]
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;  // [0, 365]
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;  // [0, 146096]
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+constexpr bool is_leap_year(std::int64_t y)
+{
+    return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+}
+
+constexpr unsigned last_day_of_month(std::int64_t y, unsigned m)
+{
+    if (m == 2) {
+        return is_leap_year(y) ? 29 : 28;
+    }
+    return (m == 4 || m == 6 || m == 9 || m == 11) ? 30 : 31;
+}
+
+/**
+ * Converts `dt` into time since the Unix epoch, in UTC, without going through
+ * `std::tm` and `std::mktime`.
+ * Unset date fields default to 1970-01-01, and unset time fields to `0`.
+ * If `tz_offset` is set, it's applied, so that the result is in UTC.
+ *
+ * Returns `std::nullopt`, if `dt` has fields that can't be converted
+ * (`wday`, `yday`, or `tz_name` that wasn't resolved into `tz_offset`),
+ * if the day doesn't exist in the month,
+ * or if the result doesn't fit in `Duration`.
+ */
 template <typename Duration>
 std::optional<Duration> time_since_unix_epoch(const datetime_components& dt)
 {
     static_assert(std::is_integral_v<typename Duration::rep>);
     static_assert(Duration::period::type::den <= std::nano::den);
 
-    if (dt.tz_offset || dt.tz_name || dt.wday || dt.yday) {
+    if ((dt.tz_name && !dt.tz_offset) || dt.wday || dt.yday) {
         return std::nullopt;
     }
 
-    auto tm = dt.to_tm();
-    // TODO: overflow checks
-#if SCN_MSVC && defined(SCN_MODULE)
-    // Workaround for https://github.com/llvm/llvm-project/issues/64812
-    // (can't use <ctime> std:: functions in modules)
-    auto time = std::chrono::seconds{::mktime(&tm)};
-#else
-    auto time = std::chrono::seconds{std::mktime(&tm)};
-#endif
-    if constexpr (Duration::period::type::den > std::intmax_t{1}) {
-        // Duration more precise than seconds (seconds is std::ratio<1, 1>)
+    const std::int64_t y = dt.year.value_or(1970);
+    const auto m = static_cast<unsigned>(dt.mon.value_or(January));
+    const auto d = static_cast<unsigned>(dt.mday.value_or(1));
+    if (d > last_day_of_month(y, m)) {
+        return std::nullopt;
+    }
+
+    auto time = std::chrono::seconds{
+        days_from_civil(y, m, d) * 86400 +
+        std::int64_t{dt.hour.value_or(0)} * 3600 +
+        std::int64_t{dt.min.value_or(0)} * 60 + std::int64_t{dt.sec.value_or(0)}};
+    if (dt.tz_offset) {
+        time -= *dt.tz_offset;
+    }
+
+    if constexpr (std::ratio_less_v<typename Duration::period, std::ratio<1>>) {
+        // Duration more precise than seconds: check for overflow
+        constexpr auto max_time =
+            std::chrono::duration_cast<std::chrono::seconds>(Duration::max());
+        constexpr auto min_time =
+            std::chrono::duration_cast<std::chrono::seconds>(Duration::min());
+        if (time >= max_time || time <= min_time) {
+            return std::nullopt;
+        }
+
+        auto result = std::chrono::duration_cast<Duration>(time);
         if (dt.subsec) {
-            auto subsec_in_ns =
+            result += std::chrono::duration_cast<Duration>(
                 std::chrono::nanoseconds{static_cast<std::int64_t>(
-                    *dt.subsec * static_cast<double>(std::nano::den))};
-            return std::chrono::duration_cast<Duration>(time + subsec_in_ns);
+                    *dt.subsec * static_cast<double>(std::nano::den))});
+        }
+        return result;
+    }
+    else {
+        // Duration is seconds or larger -> ignore subsec,
+        // and round towards the past, like std::chrono::floor<sys_days>.
+        // Done with a 64-bit rep, to check for overflow before converting
+        using rep = typename Duration::rep;
+        const auto count =
+            std::chrono::floor<
+                std::chrono::duration<std::int64_t, typename Duration::period>>(
+                time)
+                .count();
+        if constexpr (std::is_signed_v<rep>) {
+            if (count < std::int64_t{Duration::min().count()} ||
+                count > std::int64_t{Duration::max().count()}) {
+                return std::nullopt;
+            }
+        }
+        else {
+            if (count < 0 || static_cast<std::uint64_t>(count) >
+                                 std::uint64_t{Duration::max().count()}) {
+                return std::nullopt;
+            }
         }
+        return Duration{static_cast<rep>(count)};
+    }
+}
+
+/**
+ * Converts the hour, minute, second, and subsecond fields of `dt` into
+ * a `Duration`. Unset fields default to `0`.
+ *
+ * Returns `std::nullopt`, if the result doesn't fit in `Duration`,
+ * or if `Duration` has an integral rep, and can't represent the result
+ * exactly (e.g. `"01:30"` as `std::chrono::hours`).
+ */
+template <typename Duration>
+std::optional<Duration> duration_from_components(const datetime_components& dt)
+{
+    using rep = typename Duration::rep;
+
+    const auto seconds = std::int64_t{dt.hour.value_or(0)} * 3600 +
+                         std::int64_t{dt.min.value_or(0)} * 60 +
+                         std::int64_t{dt.sec.value_or(0)};
+    // Keep the total in nanoseconds from overflowing
+    constexpr std::int64_t max_seconds =
+        std::numeric_limits<std::int64_t>::max() / std::nano::den - 1;
+    if (seconds > max_seconds || seconds < -max_seconds) {
+        return std::nullopt;
+    }
+    const auto time = std::chrono::nanoseconds{
+        seconds * std::nano::den +
+        (dt.subsec ? static_cast<std::int64_t>(std::llround(
+                         *dt.subsec * static_cast<double>(std::nano::den)))
+                   : 0)};
+
+    if constexpr (std::is_floating_point_v<rep>) {
+        return std::chrono::duration_cast<Duration>(time);
+    }
+    else {
+        static_assert(Duration::period::type::den <= std::nano::den);
+
+        // Done with a 64-bit rep, to check for overflow before converting
+        const auto result = std::chrono::duration_cast<
+            std::chrono::duration<std::int64_t, typename Duration::period>>(
+            time);
+        if (std::chrono::duration_cast<std::chrono::nanoseconds>(result) !=
+            time) {
+            return std::nullopt;
+        }
+
+        const auto count = result.count();
+        if constexpr (std::is_signed_v<rep>) {
+            if (count < std::int64_t{Duration::min().count()} ||
+                count > std::int64_t{Duration::max().count()}) {
+                return std::nullopt;
+            }
+        }
+        else {
+            if (count < 0 || static_cast<std::uint64_t>(count) >
+                                 std::uint64_t{Duration::max().count()}) {
+                return std::nullopt;
+            }
+        }
+        return Duration{static_cast<rep>(count)};
     }
-    // Duration is seconds or larger, or subsec is not set
-    // -> ignore subsec
-    return std::chrono::duration_cast<Duration>(time);
 }
 
 template <typename CharT, typename Handler>
@@ -979,6 +1153,26 @@ template <>
 struct always_supports_field<year_month_day, field_tags::mday>
     : std::true_type {};
 
+/// Tag for the fields of a `std::chrono::duration` format string:
+/// only time-of-day-like fields (hours, minutes, seconds, subseconds)
+struct chrono_duration_fields {};
+
+template <typename Field>
+struct always_supports_field<chrono_duration_fields, Field> : std::false_type {
+};
+template <>
+struct always_supports_field<chrono_duration_fields, field_tags::subsec>
+    : std::true_type {};
+template <>
+struct always_supports_field<chrono_duration_fields, field_tags::sec>
+    : std::true_type {};
+template <>
+struct always_supports_field<chrono_duration_fields, field_tags::min>
+    : std::true_type {};
+template <>
+struct always_supports_field<chrono_duration_fields, field_tags::hour>
+    : std::true_type {};
+
 template <typename T>
 struct always_supports_field<T, field_tags::duration> : std::false_type {};
 
@@ -1733,9 +1927,118 @@ struct scanner<year_month_day, CharT>
     }
 };
 
+namespace detail {
+
+/**
+ * Base for `scanner`s of `std::chrono::duration` and `time_point`:
+ * with the default format string (`{}`), a tick count is read as an integer,
+ * otherwise the chrono format string is read into `datetime_components`,
+ * checked against the fields supported by `Fields`.
+ */
+template <typename CharT, typename Fields>
+struct chrono_tick_count_or_components_scanner
+    : protected chrono_datetime_scanner<CharT, datetime_components> {
+private:
+    using base = chrono_datetime_scanner<CharT, datetime_components>;
+
+public:
+    template <typename ParseCtx>
+    constexpr auto parse(ParseCtx& pctx) -> typename ParseCtx::iterator
+    {
+        if (pctx.begin() == pctx.end() || *pctx.begin() == CharT{'}'}) {
+            m_tick_count = true;
+            return pctx.begin();
+        }
+        return detail::chrono_parse_impl<Fields, CharT>(pctx, this->m_fmt_str);
+    }
+
+protected:
+    template <typename Rep, typename Context>
+    auto scan_tick_count(Rep& count, Context& ctx) const
+        -> scan_expected<typename Context::iterator>
+    {
+        return scanner<Rep, CharT>{}.scan(count, ctx);
+    }
+
+    template <typename Context>
+    auto scan_components(datetime_components& dt, Context& ctx) const
+        -> scan_expected<typename Context::iterator>
+    {
+        return base::scan(dt, ctx);
+    }
+
+    bool m_tick_count{false};
+};
+
+}  // namespace detail
+
+/**
+ * Scans a `std::chrono::duration`.
+ *
+ * With the default format string (`{}`), the tick count of the duration
+ * is read as an integer (or a floating-point value, if `Rep` is one).
+ * Otherwise, the format string can contain hours, minutes, seconds,
+ * and subseconds (e.g. `{:%H:%M:%S}`).
+ * If the scanned duration doesn't fit in `Rep`, or `Rep` is an integer type,
+ * and the duration can't be represented exactly
+ * (e.g. `01:30` as `std::chrono::hours`), an error is returned.
+ */
+template <typename CharT, typename Rep, typename Period>
+struct scanner<std::chrono::duration<Rep, Period>, CharT>
+    : public detail::chrono_tick_count_or_components_scanner<
+          CharT,
+          detail::chrono_duration_fields> {
+    using duration_type = std::chrono::duration<Rep, Period>;
+
+    template <typename Context>
+    scan_expected<typename Context::iterator> scan(duration_type& d,
+                                                   Context& ctx) const
+    {
+        if (this->m_tick_count) {
+            Rep count{};
+            auto r = this->scan_tick_count(count, ctx);
+            if (!r) {
+                return unexpected(r.error());
+            }
+            d = duration_type{count};
+            return *r;
+        }
+
+        datetime_components dt{};
+        auto r = this->scan_components(dt, ctx);
+        if (!r) {
+            return unexpected(r.error());
+        }
+        auto value = detail::duration_from_components<duration_type>(dt);
+        if (!value) {
+            return detail::unexpected_scan_error(
+                scan_error::invalid_scanned_value,
+                "Scanned duration out of range, or not representable in the "
+                "duration type");
+        }
+        d = *value;
+        return *r;
+    }
+};
+
+/**
+ * Scans a `std::chrono::time_point<std::chrono::system_clock>`
+ * (`std::chrono::sys_time`).
+ *
+ * With the default format string (`{}`), the time since the Unix epoch
+ * is read as an integer count of `Duration`s (e.g. seconds, for
+ * `std::chrono::sys_seconds`).
+ * Otherwise, the chrono format string is read, and the date and time are
+ * converted directly into time since the epoch in UTC, applying `%z`,
+ * or `%Z`, if it's resolved by the `tz_abbreviation_resolver` in use.
+ * `%a`/`%A`/`%u`/`%w` and `%j` are not supported.
+ */
 template <typename CharT, typename Duration>
 struct scanner<std::chrono::time_point<std::chrono::system_clock, Duration>,
-               CharT> : public detail::chrono_component_scanner<CharT> {
+               CharT>
+    : public detail::chrono_tick_count_or_components_scanner<
+          CharT,
+          datetime_components> {
     using time_point_type =
         std::chrono::time_point<std::chrono::system_clock, Duration>;
 
@@ -1743,8 +2046,18 @@ struct scanner<std::chrono::time_point<std::chrono::system_clock, Duration>,
     scan_expected<typename Context::iterator> scan(time_point_type& tp,
                                                    Context& ctx) const
     {
+        if (this->m_tick_count) {
+            typename Duration::rep count{};
+            auto r = this->scan_tick_count(count, ctx);
+            if (!r) {
+                return unexpected(r.error());
+            }
+            tp = time_point_type{Duration{count}};
+            return *r;
+        }
+
         datetime_components dt{};
-        auto r = detail::chrono_component_scanner<CharT>::scan(dt, ctx);
+        auto r = this->scan_components(dt, ctx);
         if (!r) {
             return unexpected(r.error());
         }
@@ -1759,6 +2072,132 @@ struct scanner<std::chrono::time_point<std::chrono::system_clock, Duration>,
     }
 };
 
+namespace detail {
+
+/**
+ * Scans a single line of a `scan_chrono_batch`, with the chrono format
+ * `fmt`, into `dt`.
+ * `fmt` is expected to have been checked before.
+ */
+SCN_PUBLIC auto chrono_scan_batch_line(std::string_view line,
+                                       std::string_view fmt,
+                                       datetime_components& dt)
+    -> scan_expected<void>;
+SCN_PUBLIC auto chrono_scan_batch_line(std::wstring_view line,
+                                       std::wstring_view fmt,
+                                       datetime_components& dt)
+    -> scan_expected<void>;
+
+template <typename CharT, typename Column>
+auto scan_chrono_batch_impl(std::basic_string_view<CharT> source,
+                            std::basic_string_view<CharT> format,
+                            Column& column)
+    -> scan_expected<scan_columns_result>
+{
+    using time_point_type = typename Column::value_type;
+    using duration_type = typename time_point_type::duration;
+    static_assert(
+        std::is_same_v<time_point_type,
+                       std::chrono::time_point<std::chrono::system_clock,
+                                               duration_type>>,
+        "scan_chrono_batch requires a column of "
+        "std::chrono::time_point<std::chrono::system_clock, Duration>");
+
+    // Check the format string once, for the whole batch
+    if (format.empty()) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "Empty chrono format string");
+    }
+    {
+        auto checker = tm_format_checker<datetime_components>{};
+        const auto end = parse_chrono_format_specs(
+            format.data(), format.data() + format.size(), checker);
+        SCN_TRY_DISCARD(checker.get_error());
+        if (end != format.data() + format.size()) {
+            return unexpected_scan_error(scan_error::invalid_format_string,
+                                         "Invalid chrono format string");
+        }
+    }
+
+    if constexpr (column_has_reserve<Column>::value) {
+        column.reserve(column.size() + count_source_lines(source));
+    }
+
+    scan_columns_result result{};
+    for (std::size_t row = 0; result.consumed < source.size(); ++row) {
+        if (column.size() >= column.max_size()) {
+            break;
+        }
+
+        const auto line = next_source_line(source, result.consumed);
+        datetime_components dt{};
+        if (auto r = chrono_scan_batch_line(line, format, dt);
+            SCN_UNLIKELY(!r)) {
+            result.errors.push_back({row, r.error()});
+            continue;
+        }
+        if (auto t = time_since_unix_epoch<duration_type>(dt);
+            SCN_LIKELY(t)) {
+            column.push_back(time_point_type{*t});
+            ++result.rows;
+        }
+        else {
+            result.errors.push_back(
+                {row, scan_error{scan_error::invalid_scanned_value,
+                                 "Invalid unix epoch"}});
+        }
+    }
+    return result;
+}
+
+}  // namespace detail
+
+/**
+ * Scans every line of `source` as a timestamp with the chrono format string
+ * `format` (like `"%Y-%m-%dT%H:%M:%S%z"`, without the surrounding `{:}`),
+ * appending the results into `column`,
+ * a column of `std::chrono::time_point<std::chrono::system_clock, Duration>`.
+ *
+ * The format string is checked only once for the whole batch,
+ * and every line is read directly from `source`, without the overhead of a
+ * separate `scn::scan` call, and without going through `std::tm`.
+ * Like in `scan_columns`, a line that fails to scan doesn't stop the
+ * batch, but is recorded in the `errors` of the result, by its index.
+ *
+ * `column` can be any container with `push_back()`, `size()`, and
+ * `max_size()`, like `std::vector` or `scn::span_out`.
+ * Scanning stops once `column` is full.
+ *
+ * \code{.cpp}
+ * std::vector<std::chrono::sys_seconds> timestamps;
+ * auto result = scn::scan_chrono_batch(
+ *     "2024-08-23 23:06:10\n2024-08-24 01:00:00\n", "%F %T", timestamps);
+ * // result->rows == 2
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename Column>
+auto scan_chrono_batch(std::string_view source,
+                       std::string_view format,
+                       Column& column) -> scan_expected<scan_columns_result>
+{
+    return detail::scan_chrono_batch_impl(source, format, column);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see scan_chrono_batch()
+ */
+template <typename Column>
+auto scan_chrono_batch(std::wstring_view source,
+                       std::wstring_view format,
+                       Column& column) -> scan_expected<scan_columns_result>
+{
+    return detail::scan_chrono_batch_impl(source, format, column);
+}
+
 SCN_END_NAMESPACE
 }  // namespace scn
 
@@ -0,0 +1,90 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/scan.h>
+
+#if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
+import std;
+#else
+#include <algorithm>
+#include <vector>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+/**
+ * A row that `scan_columns` failed to scan, and skipped.
+ */
+struct column_row_error {
+    /// Index of the row in the source, starting from 0
+    std::size_t row;
+    scan_error error;
+};
+
+/**
+ * Result of `scan_columns` and `scan_chrono_batch`.
+ */
+struct scan_columns_result {
+    /// Number of rows scanned into the columns
+    std::size_t rows{0};
+    /// Number of characters of the source that were processed.
+    /// Less than the size of the source, if a column ran out of capacity.
+    std::size_t consumed{0};
+    /// Rows that failed to scan, in order
+    std::vector<column_row_error> errors{};
+};
+
+namespace detail {
+// Number of lines in `source`, for reserving capacity up front
+template <typename CharT>
+std::size_t count_source_lines(std::basic_string_view<CharT> source)
+{
+    return static_cast<std::size_t>(
+        std::count(source.begin(), source.end(), CharT{'\n'}) + 1);
+}
+
+// Returns the line of `source` starting at `pos`, without its line break
+// (`\n` or `\r\n`), and advances `pos` to the beginning of the next line
+template <typename CharT>
+std::basic_string_view<CharT> next_source_line(
+    std::basic_string_view<CharT> source,
+    std::size_t& pos)
+{
+    auto line = source.substr(pos);
+    const auto line_end = line.find(CharT{'\n'});
+    pos = line_end == line.npos ? source.size() : pos + line_end + 1;
+    line = line.substr(0, line_end);
+    if (!line.empty() && line.back() == CharT{'\r'}) {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+template <typename Column, typename = void>
+struct column_has_reserve : std::false_type {};
+template <typename Column>
+struct column_has_reserve<Column,
+                          std::void_t<decltype(SCN_DECLVAL(Column&).reserve(
+                              SCN_DECLVAL(typename Column::size_type)))>>
+    : std::true_type {};
+}  // namespace detail
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -0,0 +1,384 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/parsed_format.h>
+
+#if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
+import std;
+#else
+#include <exception>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+/**
+ * Options for `scan_columns_parallel` and `for_each_line_parallel`.
+ *
+ * These functions use `std::thread`.
+ * `scn::scn` doesn't link with a threads library,
+ * programs using them need to do that themselves (e.g. `Threads::Threads`).
+ */
+struct scan_parallel_options {
+    /// Maximum number of threads to use.
+    /// If `0`, `std::thread::hardware_concurrency()` is used.
+    std::size_t threads{0};
+    /// Minimum number of characters for every thread to process.
+    /// Small sources are processed with fewer threads, or on the calling
+    /// thread, because starting a thread isn't free.
+    std::size_t min_chunk_size{64 * 1024};
+};
+
+namespace detail {
+
+// Splits `source` into at most `count` chunks of roughly equal size.
+// Every chunk but the last one ends with a line break.
+template <typename CharT>
+std::vector<std::basic_string_view<CharT>> split_source_into_line_chunks(
+    std::basic_string_view<CharT> source,
+    std::size_t count)
+{
+    std::vector<std::basic_string_view<CharT>> chunks;
+    chunks.reserve(count);
+    std::size_t begin = 0;
+    for (std::size_t i = 1; i <= count && begin < source.size(); ++i) {
+        std::size_t end = source.size();
+        if (i != count) {
+            const auto target = source.size() / count * i;
+            if (target <= begin) {
+                continue;
+            }
+            const auto line_break = source.find(CharT{'\n'}, target - 1);
+            if (line_break != source.npos) {
+                end = line_break + 1;
+            }
+        }
+        chunks.push_back(source.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+template <typename CharT>
+std::vector<std::basic_string_view<CharT>> split_source_for_threads(
+    std::basic_string_view<CharT> source,
+    const scan_parallel_options& options)
+{
+    std::size_t threads = options.threads != 0
+                              ? options.threads
+                              : std::thread::hardware_concurrency();
+    if (options.min_chunk_size != 0) {
+        threads = (std::min)(threads, source.size() / options.min_chunk_size);
+    }
+    return split_source_into_line_chunks(source,
+                                         (std::max)(threads, std::size_t{1}));
+}
+
+// Calls `fn(i)` for every `i` in [0, n), the first on the calling thread,
+// and the rest on threads of their own.
+// All started threads are joined before returning, even if starting a thread
+// fails. An exception thrown by `fn` is rethrown on the calling thread,
+// after every thread has finished.
+template <typename F>
+void run_in_parallel(std::size_t n, F&& fn)
+{
+    if (n == 0) {
+        return;
+    }
+
+#if SCN_HAS_EXCEPTIONS
+    std::vector<std::exception_ptr> exceptions(n);
+    auto run = [&](std::size_t i) noexcept {
+        try {
+            fn(i);
+        }
+        catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+#else
+    auto run = [&](std::size_t i) { fn(i); };
+#endif
+
+    std::vector<std::thread> threads;
+    struct join_guard {
+        ~join_guard()
+        {
+            for (auto& t : threads) {
+                t.join();
+            }
+        }
+
+        std::vector<std::thread>& threads;
+    };
+
+    {
+        join_guard guard{threads};
+        threads.reserve(n - 1);
+        for (std::size_t i = 1; i < n; ++i) {
+            threads.emplace_back([&run, i]() noexcept { run(i); });
+        }
+        run(0);
+    }
+
+#if SCN_HAS_EXCEPTIONS
+    for (const auto& e : exceptions) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+#endif
+}
+
+// Whether the columns of a chunk can be appended to `columns`,
+// with capacity left over
+template <typename ChunkColumns, std::size_t... I, typename... Columns>
+bool chunk_fits_in_columns(const ChunkColumns& chunk_columns,
+                           std::index_sequence<I...>,
+                           const Columns&... columns)
+{
+    return (... && (columns.max_size() - columns.size() >
+                    std::get<I>(chunk_columns).size()));
+}
+
+template <typename ChunkColumns, std::size_t... I, typename... Columns>
+void append_chunk_columns(ChunkColumns& chunk_columns,
+                          std::index_sequence<I...>,
+                          Columns&... columns)
+{
+    auto append = [](auto& column, auto& chunk_column) {
+        if constexpr (column_has_reserve<
+                          remove_cvref_t<decltype(column)>>::value) {
+            column.reserve(column.size() + chunk_column.size());
+        }
+        for (auto& elem : chunk_column) {
+            column.emplace_back() = SCN_MOVE(elem);
+        }
+    };
+    (append(columns, std::get<I>(chunk_columns)), ...);
+}
+
+template <typename CharT, typename... Columns>
+auto scan_columns_parallel_impl(const scan_parallel_options& options,
+                                std::basic_string_view<CharT> source,
+                                const basic_parsed_format<CharT>& format,
+                                Columns&... columns)
+    -> scan_expected<scan_columns_result>
+{
+    const auto chunks = split_source_for_threads(source, options);
+    if (chunks.size() <= 1) {
+        return scan_columns_impl(source, format, columns...);
+    }
+
+    // Every chunk is scanned into columns of its own,
+    // allocated by the thread scanning it, to avoid false sharing
+    struct chunk_result {
+        std::tuple<std::vector<typename Columns::value_type>...> columns{};
+        scan_expected<scan_columns_result> result{};
+        std::size_t line_count{0};
+    };
+    std::vector<chunk_result> results(chunks.size());
+    run_in_parallel(chunks.size(), [&](std::size_t i) {
+        auto& r = results[i];
+        r.result = std::apply(
+            [&](auto&... chunk_columns) {
+                return scan_columns_impl(chunks[i], format, chunk_columns...);
+            },
+            r.columns);
+        r.line_count = count_source_lines(chunks[i]) - 1;
+    });
+
+    // Combine, in order
+    scan_columns_result result{};
+    std::size_t row_offset = 0;
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        auto& r = results[i];
+        SCN_TRY(chunk, SCN_MOVE(r.result));
+
+        // If the columns would get full with this chunk,
+        // rows after the one filling them must not be processed
+        const auto fits = chunk_fits_in_columns(
+            r.columns, std::index_sequence_for<Columns...>{}, columns...);
+        if (!fits) {
+            // Scan the chunk again, directly into `columns`,
+            // to stop where they get full
+            SCN_TRY(rest, scan_columns_impl(chunks[i], format, columns...));
+            chunk = SCN_MOVE(rest);
+        }
+        else {
+            append_chunk_columns(r.columns,
+                                 std::index_sequence_for<Columns...>{},
+                                 columns...);
+        }
+
+        result.rows += chunk.rows;
+        for (auto& e : chunk.errors) {
+            result.errors.push_back({e.row + row_offset, e.error});
+        }
+        if (!fits) {
+            result.consumed += chunk.consumed;
+            break;
+        }
+        result.consumed += chunks[i].size();
+        row_offset += r.line_count;
+    }
+    return result;
+}
+
+template <typename CharT, typename Callback>
+void for_each_line_parallel_impl(const scan_parallel_options& options,
+                                 std::basic_string_view<CharT> source,
+                                 Callback& callback)
+{
+    const auto chunks = split_source_for_threads(source, options);
+    run_in_parallel(chunks.size(), [&](std::size_t i) {
+        std::size_t pos = 0;
+        while (pos < chunks[i].size()) {
+            callback(next_source_line(chunks[i], pos));
+        }
+    });
+}
+
+}  // namespace detail
+
+/**
+ * A parallel version of `scan_columns`.
+ *
+ * `source` is split into chunks of whole lines, one for every thread,
+ * and every chunk is scanned with `scan_columns` on a thread of its own,
+ * into columns local to that thread.
+ * The results are then combined in order, so that `columns` and the
+ * returned `scan_columns_result` (including the row indices of errors)
+ * are the same as they would be with `scan_columns`.
+ *
+ * The value types of `columns` need to be move assignable.
+ * If a column gets full, the rest of the chunk where that happens
+ * is scanned again on the calling thread, to stop at the right row.
+ *
+ * \code{.cpp}
+ * auto fmt = scn::make_parsed_format<int, double>("{} {}");
+ * std::vector<int> ids;
+ * std::vector<double> values;
+ * auto result = scn::scan_columns_parallel(huge_string, *fmt, ids, values);
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Columns>
+auto scan_columns_parallel(const scan_parallel_options& options,
+                           std::string_view source,
+                           const parsed_format& format,
+                           Columns&... columns)
+    -> scan_expected<scan_columns_result>
+{
+    return detail::scan_columns_parallel_impl(options, source, format,
+                                              columns...);
+}
+
+/// \see scan_columns_parallel()
+template <typename... Columns>
+auto scan_columns_parallel(std::string_view source,
+                           const parsed_format& format,
+                           Columns&... columns)
+    -> scan_expected<scan_columns_result>
+{
+    return detail::scan_columns_parallel_impl(scan_parallel_options{}, source,
+                                              format, columns...);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see scan_columns_parallel()
+ */
+template <typename... Columns>
+auto scan_columns_parallel(const scan_parallel_options& options,
+                           std::wstring_view source,
+                           const wparsed_format& format,
+                           Columns&... columns)
+    -> scan_expected<scan_columns_result>
+{
+    return detail::scan_columns_parallel_impl(options, source, format,
+                                              columns...);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see scan_columns_parallel()
+ */
+template <typename... Columns>
+auto scan_columns_parallel(std::wstring_view source,
+                           const wparsed_format& format,
+                           Columns&... columns)
+    -> scan_expected<scan_columns_result>
+{
+    return detail::scan_columns_parallel_impl(scan_parallel_options{}, source,
+                                              format, columns...);
+}
+
+/**
+ * Calls `callback` with every line of `source` (without the line break),
+ * from multiple threads at once, in no particular order.
+ *
+ * `source` is split like in `scan_columns_parallel`.
+ * Every line of a chunk is processed in order, on the same thread.
+ * `callback` can be called concurrently, so it needs to synchronize access
+ * to any shared state, or accumulate into per-thread (`thread_local`) state.
+ * If `callback` throws, the exception is rethrown from here,
+ * after every thread has finished.
+ *
+ * \code{.cpp}
+ * std::atomic<long long> sum{0};
+ * scn::for_each_line_parallel(huge_string, [&](std::string_view line) {
+ *     if (auto r = scn::scan_int<int>(line)) {
+ *         sum += r->value();
+ *     }
+ * });
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename Callback>
+void for_each_line_parallel(std::string_view source,
+                            Callback callback,
+                            const scan_parallel_options& options = {})
+{
+    detail::for_each_line_parallel_impl(options, source, callback);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see for_each_line_parallel()
+ */
+template <typename Callback>
+void for_each_line_parallel(std::wstring_view source,
+                            Callback callback,
+                            const scan_parallel_options& options = {})
+{
+    detail::for_each_line_parallel_impl(options, source, callback);
+}
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -0,0 +1,431 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/columns.h>
+#include <scn/scan.h>
+
+#if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
+import std;
+#else
+#include <algorithm>
+#include <memory>
+#include <vector>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+namespace detail {
+template <typename CharT>
+struct parsed_format_data {
+    std::basic_string<CharT> format;
+    std::vector<arg_type> arg_types;
+    std::vector<compiled_field> fields;
+};
+
+template <typename CharT>
+using parse_custom_specs_func =
+    scan_expected<const CharT*> (*)(basic_scan_parse_context<CharT>&);
+
+template <typename T, typename CharT>
+scan_expected<const CharT*> parse_custom_specs_for_type(
+    basic_scan_parse_context<CharT>& pctx)
+{
+    auto s = scanner<T, CharT>{};
+    SCN_TRY_DISCARD(parse_custom_specs(s, pctx));
+    return pctx.begin();
+}
+
+template <typename T, typename CharT>
+constexpr parse_custom_specs_func<CharT> get_parse_custom_specs_func()
+{
+    if constexpr (arg_type_constant<T, CharT>::value ==
+                  arg_type::custom_type) {
+        return &parse_custom_specs_for_type<T, CharT>;
+    }
+    else {
+        return nullptr;
+    }
+}
+
+SCN_PUBLIC scan_expected<void> parse_format_impl(
+    parsed_format_data<char>& data,
+    const parse_custom_specs_func<char>* custom_parse_funcs);
+SCN_PUBLIC scan_expected<void> parse_format_impl(
+    parsed_format_data<wchar_t>& data,
+    const parse_custom_specs_func<wchar_t>* custom_parse_funcs);
+
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    std::string_view source,
+    const parsed_format_data<char>& format,
+    scan_args args);
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    scan_buffer::range_type source,
+    const parsed_format_data<char>& format,
+    scan_args args);
+
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    std::wstring_view source,
+    const parsed_format_data<wchar_t>& format,
+    wscan_args args);
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    wscan_buffer::range_type source,
+    const parsed_format_data<wchar_t>& format,
+    wscan_args args);
+
+struct parsed_format_access;
+}  // namespace detail
+
+/**
+ * A format string, parsed at runtime once, and then usable for any number of
+ * calls to `scan`.
+ *
+ * The format specifiers of the replacement fields, and the argument IDs,
+ * are parsed and checked when constructing the object with
+ * `make_parsed_format`, and are not parsed again when scanning.
+ * Copying a `basic_parsed_format` is cheap: the parsed contents are shared.
+ *
+ * In header `<scn/parsed_format.h>`
+ *
+ * \code{.cpp}
+ * // Format string only known at runtime
+ * auto fmt = scn::make_parsed_format<int, std::string>(config.pattern);
+ * for (auto line : lines) {
+ *     auto result = scn::scan<int, std::string>(line, *fmt);
+ *     // ...
+ * }
+ * \endcode
+ *
+ * \ingroup format-string
+ */
+template <typename CharT>
+class basic_parsed_format {
+public:
+    using char_type = CharT;
+
+    /// The format string that was parsed
+    std::basic_string_view<CharT> get() const noexcept
+    {
+        return m_data->format;
+    }
+
+private:
+    friend struct detail::parsed_format_access;
+
+    explicit basic_parsed_format(
+        std::shared_ptr<const detail::parsed_format_data<CharT>> data)
+        : m_data(SCN_MOVE(data))
+    {
+    }
+
+    std::shared_ptr<const detail::parsed_format_data<CharT>> m_data;
+};
+
+using parsed_format = basic_parsed_format<char>;
+using wparsed_format = basic_parsed_format<wchar_t>;
+
+namespace detail {
+struct parsed_format_access {
+    template <typename CharT>
+    static basic_parsed_format<CharT> make(
+        std::shared_ptr<const parsed_format_data<CharT>> data)
+    {
+        return basic_parsed_format<CharT>{SCN_MOVE(data)};
+    }
+
+    template <typename CharT>
+    static const parsed_format_data<CharT>& get(
+        const basic_parsed_format<CharT>& format)
+    {
+        return *format.m_data;
+    }
+};
+
+template <typename CharT, typename... Args>
+auto make_parsed_format_impl(std::basic_string_view<CharT> format)
+    -> scan_expected<basic_parsed_format<CharT>>
+{
+    auto data = std::make_shared<parsed_format_data<CharT>>();
+    data->format.assign(format.data(), format.size());
+    data->arg_types = {arg_type_constant<Args, CharT>::value...};
+
+    const parse_custom_specs_func<CharT> custom_parse_funcs[] = {
+        get_parse_custom_specs_func<Args, CharT>()..., nullptr};
+    SCN_TRY_DISCARD(parse_format_impl(*data, custom_parse_funcs));
+    return parsed_format_access::make<CharT>(SCN_MOVE(data));
+}
+
+template <typename Range, typename CharT>
+auto vscan_parsed_generic(
+    Range&& range,
+    const basic_parsed_format<CharT>& format,
+    basic_scan_args<detail::default_context<CharT>> args) -> vscan_result<Range>
+{
+    vscan_guard<remove_cvref_t<Range>> guard{};
+    SCN_UNUSED(guard);
+
+    auto&& buffer = make_scan_buffer(range);
+    auto result = vscan_parsed_impl(vscan_range_type(buffer),
+                                    parsed_format_access::get(format), args);
+    if (SCN_UNLIKELY(!result)) {
+        return unexpected(result.error());
+    }
+    return make_vscan_result(SCN_FWD(range), buffer, *result);
+}
+}  // namespace detail
+
+/**
+ * Parses `format`, to be used for scanning values of types `Args...`.
+ *
+ * The format string is copied, so it doesn't need to outlive the returned
+ * object. If `format` is invalid, returns an error.
+ * The same types `Args...` must be used when scanning with the returned
+ * object, otherwise scanning fails with `scan_error::invalid_format_string`.
+ *
+ * \ingroup format-string
+ */
+template <typename... Args>
+auto make_parsed_format(std::string_view format)
+    -> scan_expected<parsed_format>
+{
+    return detail::make_parsed_format_impl<char, Args...>(format);
+}
+
+/**
+ * Perform actual scanning from `source`, according to the pre-parsed
+ * `format`, into the type-erased arguments at `args`. Called by `scan`.
+ *
+ * \ingroup vscan
+ */
+template <typename Source>
+auto vscan(Source&& source, const parsed_format& format, scan_args args)
+    -> vscan_result<Source>
+{
+    return detail::vscan_parsed_generic(SCN_FWD(source), format, args);
+}
+
+/**
+ * `scan` with a format string pre-parsed with `make_parsed_format`.
+ *
+ * \code{.cpp}
+ * auto fmt = scn::make_parsed_format<int>("{:x}");
+ * auto result = scn::scan<int>("ff", *fmt);
+ * // result->value() == 255
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_narrow_source<Source>>>
+SCN_NODISCARD auto scan(Source&& source, const parsed_format& format)
+    -> scan_result_type<Source, Args...>
+{
+    auto result = make_scan_result<Source, Args...>();
+    fill_scan_result(result, vscan(SCN_FWD(source), format,
+                                   make_scan_args(result->values())));
+    return result;
+}
+
+/**
+ * `scan` with a pre-parsed format string, and explicitly supplied default
+ * values.
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_narrow_source<Source>>>
+SCN_NODISCARD auto scan(Source&& source,
+                        const parsed_format& format,
+                        std::tuple<Args...>&& initial_args)
+    -> scan_result_type<Source, Args...>
+{
+    auto result = make_scan_result<Source>(SCN_MOVE(initial_args));
+    fill_scan_result(result, vscan(SCN_FWD(source), format,
+                                   make_scan_args(result->values())));
+    return result;
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see make_parsed_format()
+ */
+template <typename... Args>
+auto make_parsed_format(std::wstring_view format)
+    -> scan_expected<wparsed_format>
+{
+    return detail::make_parsed_format_impl<wchar_t, Args...>(format);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see vscan()
+ */
+template <typename Source>
+auto vscan(Source&& source, const wparsed_format& format, wscan_args args)
+    -> vscan_result<Source>
+{
+    return detail::vscan_parsed_generic(SCN_FWD(source), format, args);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see scan()
+ */
+template <typename... Args,
+          typename Source,
+          std::enable_if_t<detail::is_wide_source<Source>>* = nullptr>
+SCN_NODISCARD auto scan(Source&& source, const wparsed_format& format)
+    -> scan_result_type<Source, Args...>
+{
+    auto result = make_scan_result<Source, Args...>();
+    fill_scan_result(result,
+                     vscan(SCN_FWD(source), format,
+                           make_scan_args<wscan_context>(result->values())));
+    return result;
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see scan()
+ */
+template <typename... Args,
+          typename Source,
+          std::enable_if_t<detail::is_wide_source<Source>>* = nullptr>
+SCN_NODISCARD auto scan(Source&& source,
+                        const wparsed_format& format,
+                        std::tuple<Args...>&& initial_args)
+    -> scan_result_type<Source, Args...>
+{
+    auto result = make_scan_result<Source>(SCN_MOVE(initial_args));
+    fill_scan_result(result,
+                     vscan(SCN_FWD(source), format,
+                           make_scan_args<wscan_context>(result->values())));
+    return result;
+}
+
+namespace detail {
+template <typename CharT, typename... Columns>
+auto scan_columns_impl(std::basic_string_view<CharT> source,
+                       const basic_parsed_format<CharT>& format,
+                       Columns&... columns) -> scan_expected<scan_columns_result>
+{
+    check_scan_arg_types<typename Columns::value_type...>();
+
+    const auto& data = parsed_format_access::get(format);
+    const arg_type column_types[] = {
+        arg_type_constant<typename Columns::value_type, CharT>::value...,
+        arg_type::none_type};
+    if (!std::equal(data.arg_types.begin(), data.arg_types.end(),
+                    std::begin(column_types),
+                    std::prev(std::end(column_types)))) {
+        return unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "Column types don't match the types of the parsed format");
+    }
+
+    const auto row_count = count_source_lines(source);
+    auto reserve = [&](auto& column) {
+        if constexpr (column_has_reserve<
+                          remove_cvref_t<decltype(column)>>::value) {
+            column.reserve(column.size() + row_count);
+        }
+    };
+    (reserve(columns), ...);
+
+    scan_columns_result result{};
+    for (std::size_t row = 0; result.consumed < source.size(); ++row) {
+        if ((... || (columns.size() >= columns.max_size()))) {
+            break;
+        }
+
+        const auto line = next_source_line(source, result.consumed);
+
+        // Scan directly into the new elements at the end of every column
+        auto store =
+            scan_arg_store<default_context<CharT>,
+                           typename Columns::value_type...>{
+                columns.emplace_back()...};
+        if (auto r = vscan_parsed_impl(line, data, store); SCN_LIKELY(r)) {
+            ++result.rows;
+        }
+        else {
+            (columns.pop_back(), ...);
+            result.errors.push_back({row, r.error()});
+        }
+    }
+    return result;
+}
+}  // namespace detail
+
+/**
+ * Scans every line of `source` with `format`, storing the values of each
+ * line directly at the end of `columns`, one column for every argument.
+ *
+ * The format is parsed only once, in `make_parsed_format`, and column
+ * capacity is reserved up front for every line.
+ * A line that fails to scan doesn't stop the batch:
+ * its error is recorded in the returned `scan_columns_result`,
+ * and nothing is added to the columns for it.
+ *
+ * A column can be any container with `emplace_back()`, `pop_back()`,
+ * `size()` and `max_size()`, like `std::vector` or `scn::span_out`.
+ * Scanning stops once a column is full.
+ *
+ * If the value types of `columns` are different from the types used to
+ * create `format`, returns an error.
+ *
+ * \code{.cpp}
+ * auto fmt = scn::make_parsed_format<int, double>("{} {}");
+ * std::vector<int> ids;
+ * std::vector<double> values;
+ * auto result = scn::scan_columns("1 2.5\n2 3.5\n", *fmt, ids, values);
+ * // result->rows == 2
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Columns>
+auto scan_columns(std::string_view source,
+                  const parsed_format& format,
+                  Columns&... columns) -> scan_expected<scan_columns_result>
+{
+    return detail::scan_columns_impl(source, format, columns...);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see scan_columns()
+ */
+template <typename... Columns>
+auto scan_columns(std::wstring_view source,
+                  const wparsed_format& format,
+                  Columns&... columns) -> scan_expected<scan_columns_result>
+{
+    return detail::scan_columns_impl(source, format, columns...);
+}
+
+SCN_END_NAMESPACE
+}  // namespace scn
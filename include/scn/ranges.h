@@ -24,6 +24,20 @@
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
+/**
+ * What to do, when scanning a key into a map or a set that already
+ * contains it. Doesn't apply to multimaps and multisets.
+ */
+enum class duplicate_key_policy {
+    /// Keep the element scanned first, like `insert`
+    keep_first,
+    /// Overwrite the mapped value with the one scanned last.
+    /// Same as `keep_first` for sets.
+    keep_last,
+    /// Fail with `scan_error::invalid_scanned_value`
+    reject,
+};
+
 namespace detail {
 SCN_GCC_PUSH
 SCN_GCC_IGNORE("-Wctor-dtor-privacy")
@@ -163,6 +177,39 @@ scan_expected<ranges::iterator_t<Source>> scan_str(
     return it;
 }
 
+// Reads either `sep` or `close`, whichever comes first in `source`,
+// skipping preceding whitespace only once.
+// The returned bool is `true`, if `close` was read.
+template <typename Source, typename CharT>
+scan_expected<std::pair<ranges::iterator_t<Source>, bool>>
+scan_separator_or_closing_bracket(Source source,
+                                  std::basic_string_view<CharT> sep,
+                                  std::basic_string_view<CharT> close)
+{
+    SCN_TRY(begin, internal_skip_classic_whitespace(source, false));
+
+    auto try_read = [&](std::basic_string_view<CharT> str)
+        -> std::optional<ranges::iterator_t<Source>> {
+        auto it = begin;
+        for (auto ch_to_read : str) {
+            if (it == source.end() || ch_to_read != *it) {
+                return std::nullopt;
+            }
+            ++it;
+        }
+        return it;
+    };
+
+    if (auto it = try_read(close)) {
+        return std::pair{*it, true};
+    }
+    if (auto it = try_read(sep)) {
+        return std::pair{*it, false};
+    }
+    return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                 "Invalid range character");
+}
+
 template <typename Range, typename Element, typename Enable = void>
 struct has_push_back : std::false_type {};
 template <typename Range, typename Element>
@@ -188,6 +235,26 @@ struct has_element_insert<
     std::void_t<decltype(SCN_DECLVAL(Range&).insert(SCN_DECLVAL(Element&&)))>>
     : std::true_type {};
 
+template <typename Range, typename Enable = void>
+struct has_reserve : std::false_type {};
+template <typename Range>
+struct has_reserve<Range,
+                   decltype(SCN_DECLVAL(Range&).reserve(
+                       SCN_DECLVAL(typename Range::size_type)))>
+    : std::true_type {};
+
+// emplace_back() returning a reference to the new element
+template <typename Range, typename Element, typename Enable = void>
+struct has_emplace_back : std::false_type {};
+template <typename Range, typename Element>
+struct has_emplace_back<
+    Range,
+    Element,
+    std::enable_if_t<
+        std::is_same_v<decltype(SCN_DECLVAL(Range&).emplace_back()), Element&>,
+        std::void_t<decltype(SCN_DECLVAL(Range&).pop_back())>>>
+    : std::true_type {};
+
 template <typename Range,
           typename Element,
           typename = std::enable_if_t<!std::is_reference_v<Element>>>
@@ -208,17 +275,108 @@ void add_element_to_range(Range& r, Element&& elem)
     }
 }
 
+// A range that can't be inserted into, but whose elements can be assigned
+// to, like std::array
+template <typename Range, typename Element, typename Enable = void>
+struct is_fixed_size_output_range : std::false_type {};
+template <typename Range, typename Element>
+struct is_fixed_size_output_range<
+    Range,
+    Element,
+    std::enable_if_t<!has_push_back<Range, Element>::value &&
+                     !has_push<Range, Element>::value &&
+                     !has_element_insert<Range, Element>::value &&
+                     ranges::sized_range<Range> &&
+                     std::is_same_v<ranges::range_reference_t<Range>,
+                                    Element&>>> : std::true_type {};
+
+template <typename Range, typename Element, typename Enable = void>
+struct has_emplace_hint : std::false_type {};
+template <typename Range, typename Element>
+struct has_emplace_hint<
+    Range,
+    Element,
+    std::void_t<decltype(SCN_DECLVAL(Range&).emplace_hint(
+        SCN_DECLVAL(Range&).end(),
+        SCN_DECLVAL(Element&&)))>> : std::true_type {};
+
+template <typename Range, typename Element, typename Enable = void>
+struct has_insert_or_assign : std::false_type {};
+template <typename Range, typename Element>
+struct has_insert_or_assign<
+    Range,
+    Element,
+    std::void_t<decltype(SCN_DECLVAL(Range&).insert_or_assign(
+        SCN_DECLVAL(Range&).end(),
+        SCN_MOVE(SCN_DECLVAL(Element&).first),
+        SCN_MOVE(SCN_DECLVAL(Element&).second)))>> : std::true_type {};
+
+// insert() returns pair<iterator, bool>, i.e. keys are unique
+template <typename Range, typename Element, typename Enable = void>
+struct has_unique_keys : std::false_type {};
+template <typename Range, typename Element>
+struct has_unique_keys<
+    Range,
+    Element,
+    std::enable_if_t<std::is_same_v<
+        decltype(SCN_DECLVAL(Range&).insert(SCN_DECLVAL(Element&&))),
+        std::pair<typename Range::iterator, bool>>>> : std::true_type {};
+
+// Inserts into a map or a set, with a hint at the end,
+// so that sorted input is inserted in amortized constant time.
+// Returns false, if `elem` was rejected as a duplicate.
+template <typename Range, typename Element>
+bool add_element_to_associative_range(Range& r,
+                                      Element&& elem,
+                                      duplicate_key_policy policy)
+{
+    if constexpr (has_unique_keys<Range, Element>::value) {
+        if (policy == duplicate_key_policy::reject) {
+            if constexpr (has_emplace_hint<Range, Element>::value) {
+                // A duplicate leaves the size unchanged
+                const auto size_before = r.size();
+                r.emplace_hint(r.end(), SCN_MOVE(elem));
+                return r.size() != size_before;
+            }
+            else {
+                return r.insert(SCN_MOVE(elem)).second;
+            }
+        }
+        if constexpr (has_insert_or_assign<Range, Element>::value) {
+            if (policy == duplicate_key_policy::keep_last) {
+                r.insert_or_assign(r.end(), SCN_MOVE(elem.first),
+                                   SCN_MOVE(elem.second));
+                return true;
+            }
+        }
+    }
+
+    if constexpr (has_emplace_hint<Range, Element>::value) {
+        r.emplace_hint(r.end(), SCN_MOVE(elem));
+    }
+    else {
+        add_element_to_range(r, SCN_MOVE(elem));
+    }
+    return true;
+}
+
 template <typename Range, typename Enable = void>
 struct has_max_size : std::false_type {};
 template <typename Range>
-struct has_max_size<Range, decltype(SCN_DECLVAL(const Range&).max_size())>
+struct has_max_size<
+    Range,
+    std::void_t<decltype(SCN_DECLVAL(const Range&).max_size())>>
     : std::true_type {};
 
 template <typename Range, typename DiffT = ranges::range_difference_t<Range>>
 DiffT range_max_size(const Range& r)
 {
     if constexpr (has_max_size<Range>::value) {
-        return static_cast<DiffT>(r.max_size());
+        using unsigned_type = std::make_unsigned_t<DiffT>;
+        return static_cast<DiffT>(
+            std::min(static_cast<unsigned_type>(r.max_size()),
+                     static_cast<unsigned_type>(
+                         std::numeric_limits<DiffT>::max())));
     }
     else {
         return std::numeric_limits<DiffT>::max();
@@ -249,6 +407,12 @@ protected:
 
 template <typename CharT>
 class range_scanner_base_for_ranges : public range_scanner_base<CharT> {
+public:
+    constexpr void set_duplicate_key_policy(duplicate_key_policy policy)
+    {
+        m_duplicate_key_policy = policy;
+    }
+
 protected:
     template <typename T, typename Scan, typename Range, typename Context>
     scan_expected<typename Context::iterator> scan_impl(Scan scan_cb,
@@ -258,45 +422,167 @@ protected:
         SCN_TRY(it, detail::scan_str(ctx.range(), this->m_opening_bracket));
         ctx.advance_to(it);
 
-        using diff_type = ranges::range_difference_t<Range>;
-        for (diff_type i = 0; i < detail::range_max_size(range); ++i) {
-            if (auto e = detail::scan_str(ctx.range(), this->m_closing_bracket);
-                e) {
-                break;
+        if (auto e = detail::scan_str(ctx.range(), this->m_closing_bracket);
+            e) {
+            if constexpr (detail::is_fixed_size_output_range<Range,
+                                                             T>::value) {
+                if (ranges::size(range) != 0) {
+                    return detail::unexpected_scan_error(
+                        scan_error::invalid_scanned_value,
+                        "Too few elements for range");
+                }
             }
+            return e;
+        }
+
+        if constexpr (detail::is_fixed_size_output_range<Range, T>::value) {
+            return scan_fixed_size(scan_cb, range, ctx);
+        }
+        else {
+            return scan_insertable<T>(scan_cb, range, ctx);
+        }
+    }
+
+private:
+    template <typename T, typename Scan, typename Range, typename Context>
+    scan_expected<typename Context::iterator>
+    scan_insertable(Scan scan_cb, Range& range, Context& ctx) const
+    {
+        if constexpr (detail::has_reserve<Range>::value) {
+            reserve_for_elements(range, ctx);
+        }
 
-            T elem{};
-            if (auto e = scan_inner_loop(scan_cb, ctx, elem, i == 0);
-                SCN_LIKELY(e)) {
-                detail::add_element_to_range(range, SCN_MOVE(elem));
-                ctx.advance_to(*e);
+        using diff_type = ranges::range_difference_t<Range>;
+        for (diff_type i = 0; i < detail::range_max_size(range); ++i) {
+            if constexpr (std::is_arithmetic_v<T> &&
+                          detail::has_emplace_back<Range, T>::value) {
+                // Scan directly into the range, instead of moving from a
+                // temporary
+                auto& elem = range.emplace_back();
+                if (auto e = scan_cb(elem, ctx, i == 0); SCN_LIKELY(e)) {
+                    ctx.advance_to(*e);
+                }
+                else {
+                    range.pop_back();
+                    return e;
+                }
             }
             else {
-                return e;
+                T elem{};
+                SCN_TRY(it, scan_cb(detail::range_mapper<CharT>().map(elem),
+                                    ctx, i == 0));
+                if constexpr (detail::is_map<Range>::value ||
+                              detail::is_set<Range>::value) {
+                    if (SCN_UNLIKELY(!detail::add_element_to_associative_range(
+                            range, SCN_MOVE(elem),
+                            this->m_duplicate_key_policy))) {
+                        return detail::unexpected_scan_error(
+                            scan_error::invalid_scanned_value,
+                            "Duplicate key in range");
+                    }
+                }
+                else {
+                    detail::add_element_to_range(range, SCN_MOVE(elem));
+                }
+                ctx.advance_to(it);
+            }
+
+            SCN_TRY(next, detail::scan_separator_or_closing_bracket(
+                              ctx.range(), this->m_separator,
+                              this->m_closing_bracket));
+            ctx.advance_to(next.first);
+            if (next.second) {
+                return ctx.begin();
             }
         }
 
-        return detail::scan_str(ctx.range(), this->m_closing_bracket);
+        return detail::unexpected_scan_error(
+            scan_error::invalid_scanned_value,
+            "Too many elements for range");
     }
 
-private:
-    template <typename Scan, typename Context, typename Elem>
+    // Every element of `range` is assigned to,
+    // and the number of scanned elements must match its size
+    template <typename Scan, typename Range, typename Context>
     scan_expected<typename Context::iterator>
-    scan_inner_loop(Scan scan_cb, Context& ctx, Elem& elem, bool is_first) const
+    scan_fixed_size(Scan scan_cb, Range& range, Context& ctx) const
     {
-        auto skip_separator =
-            [](auto src, auto sep,
-               bool f) -> scan_expected<typename Context::iterator> {
-            if (f) {
-                return src.begin();
+        bool is_first = true;
+        for (auto& elem : range) {
+            if (!is_first) {
+                SCN_TRY(next, detail::scan_separator_or_closing_bracket(
+                                  ctx.range(), this->m_separator,
+                                  this->m_closing_bracket));
+                ctx.advance_to(next.first);
+                if (next.second) {
+                    return detail::unexpected_scan_error(
+                        scan_error::invalid_scanned_value,
+                        "Too few elements for range");
+                }
             }
-            return detail::scan_str(src, sep);
-        };
 
-        SCN_TRY(it, skip_separator(ctx.range(), this->m_separator, is_first));
-        ctx.advance_to(it);
-        return scan_cb(detail::range_mapper<CharT>().map(elem), ctx, is_first);
+            SCN_TRY(it, scan_cb(detail::range_mapper<CharT>().map(elem), ctx,
+                                is_first));
+            ctx.advance_to(it);
+            is_first = false;
+        }
+
+        SCN_TRY(next, detail::scan_separator_or_closing_bracket(
+                          ctx.range(), this->m_separator,
+                          this->m_closing_bracket));
+        if (!next.second) {
+            return detail::unexpected_scan_error(
+                scan_error::invalid_scanned_value,
+                "Too many elements for range");
+        }
+        return next.first;
+    }
+
+    // Maximum number of elements reserved for up front,
+    // the source may be untrusted
+    static constexpr std::size_t max_reserved_elements = 4096;
+
+    // Reserves space for the number of separators in the buffered part of
+    // the source, if the closing bracket is also buffered,
+    // up to `max_reserved_elements`.
+    // This is only a hint: nested ranges or strings containing separators
+    // make it inaccurate.
+    template <typename Range, typename Context>
+    void reserve_for_elements(Range& range, Context& ctx) const
+    {
+        if constexpr (std::is_same_v<
+                          typename Context::iterator,
+                          typename basic_scan_buffer<CharT>::iterator>) {
+            if (this->m_separator.empty() || this->m_closing_bracket.empty()) {
+                return;
+            }
+
+            auto segment = ctx.begin().contiguous_segment();
+            const auto closing_bracket_pos =
+                segment.find(this->m_closing_bracket.front());
+            if (closing_bracket_pos == std::basic_string_view<CharT>::npos) {
+                return;
+            }
+            segment = segment.substr(0, closing_bracket_pos);
+
+            std::size_t count = 1;
+            for (auto pos = segment.find(this->m_separator);
+                 pos != std::basic_string_view<CharT>::npos &&
+                 count < max_reserved_elements;
+                 pos = segment.find(this->m_separator,
+                                    pos + this->m_separator.size())) {
+                ++count;
+            }
+
+            using size_type = typename Range::size_type;
+            range.reserve(static_cast<size_type>(
+                std::min(count + range.size(),
+                         static_cast<std::size_t>(range.max_size()))));
+        }
     }
+
+    duplicate_key_policy m_duplicate_key_policy{
+        duplicate_key_policy::keep_first};
 };
 
 template <typename T>
@@ -377,6 +663,121 @@ private:
     }
 };
 
+/**
+ * A view over caller-provided storage, that scanned range elements are
+ * written into.
+ *
+ * Scanning a `span_out` never allocates: elements are written to the
+ * storage in order, until its capacity is reached. A source range with more
+ * elements than that is an error.
+ *
+ * \code{.cpp}
+ * int buf[8]{};
+ * auto result = scn::scan<scn::span_out<int>>("[1, 2, 3]", "{}",
+ *                                             {scn::span_out<int>{buf}});
+ * // result->value().size() == 3
+ * \endcode
+ */
+template <typename T>
+class span_out {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr span_out() = default;
+
+    constexpr span_out(T* data, std::size_t capacity) noexcept
+        : m_data(data), m_capacity(capacity)
+    {
+    }
+
+    template <std::size_t N>
+    constexpr span_out(T (&arr)[N]) noexcept : span_out(arr, N)
+    {
+    }
+
+    /// Storage from a contiguous container, like `std::array` or
+    /// `std::vector`, using its current size as the capacity
+    template <typename Container,
+              typename = std::enable_if_t<
+                  !std::is_same_v<detail::remove_cvref_t<Container>,
+                                  span_out> &&
+                  std::is_convertible_v<
+                      decltype(SCN_DECLVAL(Container&).data()),
+                      T*>>>
+    constexpr span_out(Container& c) noexcept : span_out(c.data(), c.size())
+    {
+    }
+
+    constexpr T* data() const noexcept
+    {
+        return m_data;
+    }
+    /// Number of elements written
+    constexpr std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+    constexpr std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+    constexpr std::size_t max_size() const noexcept
+    {
+        return m_capacity;
+    }
+    constexpr bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    constexpr T* begin() const noexcept
+    {
+        return m_data;
+    }
+    constexpr T* end() const noexcept
+    {
+        return m_data + m_size;
+    }
+
+    constexpr T& operator[](std::size_t i) const
+    {
+        SCN_EXPECT(i < m_size);
+        return m_data[i];
+    }
+
+    constexpr void push_back(T&& value)
+    {
+        SCN_EXPECT(m_size < m_capacity);
+        m_data[m_size++] = SCN_MOVE(value);
+    }
+    constexpr T& emplace_back()
+    {
+        SCN_EXPECT(m_size < m_capacity);
+        return m_data[m_size++] = T{};
+    }
+    constexpr void pop_back()
+    {
+        SCN_EXPECT(m_size > 0);
+        --m_size;
+    }
+
+    constexpr void clear() noexcept
+    {
+        m_size = 0;
+    }
+
+private:
+    T* m_data{nullptr};
+    std::size_t m_size{0};
+    std::size_t m_capacity{0};
+};
+
 template <typename T, typename CharT, typename Enable = void>
 class range_scanner;
 
@@ -24,6 +24,9 @@
 #if defined(SCN_MODULE) && defined(SCN_IMPORT_STD)
 import std;
 #else
+#include <algorithm>
+#include <array>
+#include <stdexcept>
 #include <vector>
 #endif
 
@@ -216,11 +219,71 @@ private:
 #endif
 };
 
+namespace detail {
+/**
+ * A vector of trivially copyable `T`s, with space for `N` elements inline.
+ * Only supports resizing, which discards the previous elements.
+ */
+template <typename T, std::size_t N>
+class regex_matches_storage {
+public:
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    regex_matches_storage() = default;
+
+    void reset(std::size_t n)
+    {
+        if (n > N) {
+            // Reuses the capacity of previous allocations
+            m_heap.assign(n, T{});
+        }
+        else {
+            std::fill_n(m_inline.data(), n, T{});
+        }
+        m_size = n;
+    }
+
+    T* data()
+    {
+        return m_size > N ? m_heap.data() : m_inline.data();
+    }
+    const T* data() const
+    {
+        return m_size > N ? m_heap.data() : m_inline.data();
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    T& operator[](std::size_t i)
+    {
+        SCN_EXPECT(i < m_size);
+        return data()[i];
+    }
+    const T& operator[](std::size_t i) const
+    {
+        SCN_EXPECT(i < m_size);
+        return data()[i];
+    }
+
+private:
+    std::array<T, N> m_inline{};
+    std::vector<T> m_heap{};
+    std::size_t m_size{0};
+};
+}  // namespace detail
+
 /**
  * Can be used to get all subexpression captures of a regex match.
  * Interface similar to a
  * `const std::vector<std::optional<basic_regex_match<CharT>>>`.
- * Stores `[0]` as a string, and the other matches as views into that string.
+ * Stores a copy of `[0]`, and the other matches as views into that copy.
+ *
+ * Up to `inline_submatch_capacity` subexpressions, and
+ * `inline_text_capacity` code units of the entire match and the names of
+ * the captures, are stored without allocating memory.
  *
  * \code{.cpp}
  * auto result =
@@ -236,6 +299,9 @@ private:
 template <typename CharT>
 class basic_regex_matches {
 public:
+    static constexpr std::size_t inline_submatch_capacity = 8;
+    static constexpr std::size_t inline_text_capacity = 128;
+
     struct submatch {
         std::size_t pos{};
         std::size_t len{};
@@ -258,56 +324,88 @@ public:
 
     basic_regex_matches(std::basic_string<CharT> match,
                         std::vector<submatch> submatches)
-        : m_match(SCN_MOVE(match)), m_submatches(SCN_MOVE(submatches))
     {
+        std::size_t names_size = 0;
+#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
+        for (const auto& sm : submatches) {
+            names_size += sm.name.size();
+        }
+#endif
+        reset(match, submatches.size(), names_size);
+        for (std::size_t i = 0; i < submatches.size(); ++i) {
+            set_submatch(i + 1, submatches[i].pos, submatches[i].len);
+#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
+            if (!submatches[i].name.empty()) {
+                set_submatch_name(i + 1, submatches[i].name);
+            }
+#endif
+        }
+    }
+
+    /**
+     * Replaces the contents of `*this` with the entire match `match`,
+     * followed by `n` unmatched subexpressions.
+     * `names_size` is the total length of the capture names,
+     * that will be set with `set_submatch_name`.
+     *
+     * Used by the implementation, reuses the memory of `*this`.
+     */
+    void reset(std::basic_string_view<CharT> match,
+               std::size_t n,
+               std::size_t names_size = 0)
+    {
+        m_text.reset(match.size() + names_size);
+        std::copy(match.begin(), match.end(), m_text.data());
+        m_match_size = match.size();
+        m_names_end = match.size();
+        m_submatches.reset(n);
+    }
+
+    /// Sets the subexpression `i` (1-based), relative to the entire match
+    void set_submatch(std::size_t i, std::size_t pos, std::size_t len)
+    {
+        SCN_EXPECT(i > 0 && i <= m_submatches.size());
+        SCN_EXPECT(pos + len <= m_match_size);
+        m_submatches[i - 1].pos = pos;
+        m_submatches[i - 1].len = len;
+    }
+
+#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
+    /// Sets the name of the subexpression `i` (1-based)
+    void set_submatch_name(std::size_t i, std::basic_string_view<CharT> name)
+    {
+        SCN_EXPECT(i > 0 && i <= m_submatches.size());
+        SCN_EXPECT(m_names_end + name.size() <= m_text.size());
+        std::copy(name.begin(), name.end(), m_text.data() + m_names_end);
+        m_submatches[i - 1].name_pos = m_names_end;
+        m_submatches[i - 1].name_len = name.size();
+        m_names_end += name.size();
     }
+#endif
 
     SCN_NODISCARD std::optional<match_type> operator[](std::size_t i) const
     {
         if (i == 0) {
-            return match_type{m_match};
+            return match_type{get_text(0, m_match_size)};
         }
         SCN_EXPECT(i <= m_submatches.size());
-        const auto& sm = m_submatches[i - 1];
-        if (!sm) {
-            return std::nullopt;
-        }
-#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
-        if (sm.name.empty()) {
-            return match_type{detail::make_string_view_from_pointers(
-                m_match.data() + sm.pos, m_match.data() + sm.pos + sm.len)};
-        }
-        return match_type{
-            detail::make_string_view_from_pointers(
-                m_match.data() + sm.pos, m_match.data() + sm.pos + sm.len),
-            sm.name};
-#else
-        return match_type{detail::make_string_view_from_pointers(
-            m_match.data() + sm.pos, m_match.data() + sm.pos + sm.len)};
-#endif
+        return get_submatch(m_submatches[i - 1]);
     }
 
     SCN_NODISCARD std::optional<match_type> at(std::size_t i) const
     {
         if (i == 0) {
-            return match_type{m_match};
+            return match_type{get_text(0, m_match_size)};
         }
-        const auto& sm = m_submatches.at(i - 1);
-        if (!sm) {
-            return std::nullopt;
+#if SCN_HAS_EXCEPTIONS
+        if (i > m_submatches.size()) {
+            SCN_UNLIKELY_ATTR
+            throw std::out_of_range("basic_regex_matches::at");
         }
-#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
-        if (sm.name.empty()) {
-            return match_type{
-                std::basic_string_view<CharT>{m_match}.substr(sm.pos, sm.len)};
-        }
-        return match_type{
-            std::basic_string_view<CharT>{m_match}.substr(sm.pos, sm.len),
-            sm.name};
 #else
-        return match_type{
-            std::basic_string_view<CharT>{m_match}.substr(sm.pos, sm.len)};
+        SCN_EXPECT(i <= m_submatches.size());
 #endif
+        return get_submatch(m_submatches[i - 1]);
     }
 
     SCN_NODISCARD std::size_t size() const
@@ -435,8 +533,49 @@ public:
     }
 
 private:
-    std::basic_string<CharT> m_match{};
-    std::vector<submatch> m_submatches{};
+    std::basic_string_view<CharT> get_text(std::size_t pos,
+                                           std::size_t len) const
+    {
+        return {m_text.data() + pos, len};
+    }
+
+    // Like `submatch`, but trivially copyable,
+    // with the name stored after the entire match in `m_text`
+    struct stored_submatch {
+        std::size_t pos{};
+        std::size_t len{};
+#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
+        // `name_len == 0` if the capture has no name
+        std::size_t name_pos{};
+        std::size_t name_len{};
+#endif
+
+        explicit operator bool() const
+        {
+            return len != 0;
+        }
+    };
+
+    std::optional<match_type> get_submatch(const stored_submatch& sm) const
+    {
+        if (!sm) {
+            return std::nullopt;
+        }
+#if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
+        if (sm.name_len != 0) {
+            return match_type{get_text(sm.pos, sm.len),
+                              get_text(sm.name_pos, sm.name_len)};
+        }
+#endif
+        return match_type{get_text(sm.pos, sm.len)};
+    }
+
+    // The entire match, followed by the names of the captures
+    detail::regex_matches_storage<CharT, inline_text_capacity> m_text{};
+    detail::regex_matches_storage<stored_submatch, inline_submatch_capacity>
+        m_submatches{};
+    std::size_t m_match_size{0};
+    std::size_t m_names_end{0};
 };
 
 static_assert(ranges::bidirectional_range<basic_regex_matches<char>>);
@@ -474,6 +613,132 @@ struct scanner<basic_regex_matches<CharT>, CharT>
     }
 };
 
+namespace detail {
+template <typename CharT>
+class basic_regex_handle {
+public:
+    constexpr basic_regex_handle() = default;
+
+    template <typename Regex>
+    SCN_PUBLIC explicit basic_regex_handle(const Regex& re);
+
+    constexpr const void* get() const noexcept
+    {
+        return m_regex;
+    }
+
+private:
+    const void* m_regex{nullptr};
+};
+
+template <typename T>
+struct regex_ref_char_type;
+template <typename CharT>
+struct regex_ref_char_type<std::basic_string<CharT>> {
+    using type = CharT;
+};
+template <typename CharT>
+struct regex_ref_char_type<std::basic_string_view<CharT>> {
+    using type = CharT;
+};
+template <typename CharT>
+struct regex_ref_char_type<basic_regex_matches<CharT>> {
+    using type = CharT;
+};
+
+template <typename CharT, typename T>
+SCN_PUBLIC auto scan_regex_ref(basic_regex_handle<CharT> regex,
+                               T& value,
+                               default_context<CharT>& ctx)
+    -> scan_expected<typename default_context<CharT>::iterator>;
+}  // namespace detail
+
+/**
+ * Scans a value of type `T` with a regex compiled beforehand by the user,
+ * instead of a pattern given in the format string.
+ * No regex is compiled during scanning.
+ *
+ * `T` can be a string (`std::basic_string` or `std::basic_string_view`),
+ * or `scn::basic_regex_matches`.
+ *
+ * The regex must be of the type used by the regex backend:
+ *  - `std`: `std::regex` or `std::wregex`
+ *  - `Boost`: `boost::regex` or `boost::wregex`,
+ *    or `boost::u32regex` if using the ICU.
+ *    With the ICU, the names of captures aren't available.
+ *  - `re2`: `re2::RE2`
+ *
+ * Other types of regexes cause a linker error.
+ * The regex isn't copied, so it must outlive the `regex_ref`.
+ *
+ * \code{.cpp}
+ * auto re = std::regex{"([a-z]+)([0-9]+)"};
+ * auto result = scn::scan<scn::regex_ref<scn::regex_matches>>(
+ *     "abc123", "{}", {scn::regex_ref<scn::regex_matches>{re}});
+ * // result->value().value() has three elements:
+ * //  [0]: "abc123" (entire match)
+ * //  [1]: "abc" (first subexpression match)
+ * //  [2]: "123" (second subexpression match)
+ * \endcode
+ *
+ * \ingroup regex
+ */
+template <typename T>
+class regex_ref {
+public:
+    using value_type = T;
+    using char_type = typename detail::regex_ref_char_type<T>::type;
+
+    regex_ref() = default;
+
+    template <typename Regex>
+    explicit regex_ref(const Regex& re) : m_regex(re)
+    {
+    }
+
+    /// Scanned value
+    T& value() &
+    {
+        return m_value;
+    }
+    /// Scanned value
+    const T& value() const&
+    {
+        return m_value;
+    }
+    /// Scanned value
+    T&& value() &&
+    {
+        return SCN_MOVE(m_value);
+    }
+
+private:
+    template <typename, typename, typename>
+    friend struct scanner;
+
+    detail::basic_regex_handle<char_type> m_regex{};
+    T m_value{};
+};
+
+template <typename T, typename CharT>
+struct scanner<regex_ref<T>, CharT> {
+    static_assert(std::is_same_v<typename regex_ref<T>::char_type, CharT>,
+                  "Cannot transcode with regex_ref");
+
+    template <typename ParseCtx>
+    constexpr auto parse(ParseCtx& pctx) -> typename ParseCtx::iterator
+    {
+        return pctx.begin();
+    }
+
+    template <typename Context>
+    auto scan(regex_ref<T>& ref, Context& ctx) const
+        -> scan_expected<typename Context::iterator>
+    {
+        return detail::scan_regex_ref(ref.m_regex, ref.m_value, ctx);
+    }
+};
+
 SCN_END_NAMESPACE
 }  // namespace scn
 
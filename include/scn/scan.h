@@ -7279,8 +7279,8 @@ struct custom_wrapper {
     T& val;
 };
 
-template <typename T, typename Scanner, typename ParseCtx>
-scan_expected<void> parse_custom_arg(T&, Scanner& s, ParseCtx& pctx)
+template <typename Scanner, typename ParseCtx>
+scan_expected<void> parse_custom_specs(Scanner& s, ParseCtx& pctx)
 {
 #if SCN_HAS_EXCEPTIONS
     auto fmt_it = pctx.begin();
@@ -7307,7 +7307,7 @@ scan_expected<void> parse_custom_arg(T&, Scanner& s, ParseCtx& pctx)
         SCN_CLANG_POP
     }
 #else
-    auto fmt_it = s.parse(pctx_ref);
+    auto fmt_it = s.parse(pctx);
 #endif
     if (auto e = pctx.get_error(); SCN_UNLIKELY(!e)) {
         return e;
@@ -7316,6 +7316,12 @@ scan_expected<void> parse_custom_arg(T&, Scanner& s, ParseCtx& pctx)
     return {};
 }
 
+template <typename T, typename Scanner, typename ParseCtx>
+scan_expected<void> parse_custom_arg(T&, Scanner& s, ParseCtx& pctx)
+{
+    return parse_custom_specs(s, pctx);
+}
+
 class arg_value {
 public:
     // trivial default initialization in constexpr
@@ -7869,6 +7875,10 @@ public:
         : args(std::apply(make_argptrs<Args...>, a))
     {
     }
+    constexpr explicit scan_arg_store(Args&... a) noexcept
+        : args(make_argptrs<Args...>(a...))
+    {
+    }
 
     argptrs_type args;
 
@@ -11534,7 +11544,9 @@ internal_skip_classic_whitespace(Range r, bool allow_exhaustion);
 #define SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_CTX(Context)                  \
     SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(char, Context)               \
     SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(wchar_t, Context)            \
-    SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(signed char, Context)        \
+    SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(char32_t, Context)           \
+    SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(bool, Context)               \
+    SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(void*, Context)              \
     SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(signed char, Context)        \
     SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(short, Context)              \
     SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_TYPE(int, Context)                \
@@ -12114,6 +12126,996 @@ SCN_GCC_POP  // -Wnoexcept
 {
 }
 
+/////////////////////////////////////////////////////////////////
+// Compiled format strings
+/////////////////////////////////////////////////////////////////
+
+namespace detail {
+struct compiled_string : compile_string {};
+
+template <typename Str>
+inline constexpr bool is_compiled_string_v =
+    std::is_base_of_v<compiled_string, Str>;
+
+#if !SCN_DISABLE_REGEX
+
+/*
+ * Compile-time regex engine, used for regexes in SCN_COMPILE format strings.
+ *
+ * A pattern is compiled into a sequence of atoms, each of which matches a
+ * single code unit from a set, repeated between `min` and `max` times.
+ * Only a small subset of the regex syntax is supported:
+ *  - literal ASCII characters, and escaped special characters
+ *  - `.`, `\d`, `\w`, `\s`, `\D`, `\W`, `\S`, `\t`, `\n`, `\v`, `\f`, `\r`
+ *  - bracketed character sets, like `[a-z_]` or `[^,]`
+ *  - the greedy quantifiers `*`, `+`, `?`, `{n}`, `{n,}`, and `{n,m}`
+ * Patterns using anything else, like groups, alternatives, or anchors, are
+ * left to the regex backend.
+ *
+ * A pattern is also left to the backend, if an atom with a variable
+ * repetition count can match a code unit that could begin the rest of the
+ * pattern, and the rest of the pattern can fail to match, like in `a*ab` or
+ * `\w+\s*\w+`. Every other pattern can be matched without backtracking:
+ * every atom takes as many code units as it can, which is what a
+ * backtracking matcher would end up with, too. This makes matching a single
+ * linear pass over the input.
+ *
+ * Matching is done on code units, like in std::regex. Because of this, atoms
+ * that can match non-ASCII code units (`.` and negated sets) are only
+ * supported when matching narrow strings with the std backend.
+ */
+
+inline constexpr std::size_t ct_regex_unbounded =
+    std::numeric_limits<std::size_t>::max();
+
+struct ct_regex_atom {
+    // Bitmap of the ASCII code units matched by this atom
+    std::array<std::uint64_t, 2> ascii{};
+    // Whether this atom matches all non-ASCII code units
+    bool nonascii{false};
+    std::size_t min{1};
+    std::size_t max{1};
+
+    constexpr void set(unsigned ch)
+    {
+        ascii[ch / 64] |= std::uint64_t{1} << (ch % 64);
+    }
+    constexpr void set_range(unsigned first, unsigned last)
+    {
+        for (; first <= last; ++first) {
+            set(first);
+        }
+    }
+    constexpr bool test(unsigned ch) const
+    {
+        return ((ascii[ch / 64] >> (ch % 64)) & 1u) != 0;
+    }
+
+    constexpr bool intersects(const ct_regex_atom& other) const
+    {
+        return (ascii[0] & other.ascii[0]) != 0 ||
+               (ascii[1] & other.ascii[1]) != 0 ||
+               (nonascii && other.nonascii);
+    }
+    constexpr void add(const ct_regex_atom& other)
+    {
+        ascii[0] |= other.ascii[0];
+        ascii[1] |= other.ascii[1];
+        nonascii |= other.nonascii;
+    }
+
+    constexpr void invert()
+    {
+        ascii[0] = ~ascii[0];
+        ascii[1] = ~ascii[1];
+        nonascii = !nonascii;
+    }
+
+    constexpr void add_other_case()
+    {
+        for (unsigned ch = 'a'; ch <= 'z'; ++ch) {
+            if (test(ch) || test(ch - 'a' + 'A')) {
+                set(ch);
+                set(ch - 'a' + 'A');
+            }
+        }
+    }
+
+    template <typename CharT>
+    constexpr bool matches(CharT ch) const
+    {
+        const auto u = static_cast<std::make_unsigned_t<CharT>>(ch);
+        if (u >= 128) {
+            return nonascii;
+        }
+        return test(static_cast<unsigned>(u));
+    }
+};
+
+// Adds the set for an escape sequence `\ch` into `atom`
+template <typename CharT>
+constexpr bool parse_ct_regex_escape(CharT ch, ct_regex_atom& atom)
+{
+    ct_regex_atom set{};
+    bool invert = false;
+    switch (ch) {
+        case CharT{'D'}:
+            invert = true;
+            [[fallthrough]];
+        case CharT{'d'}:
+            set.set_range('0', '9');
+            break;
+
+        case CharT{'W'}:
+            invert = true;
+            [[fallthrough]];
+        case CharT{'w'}:
+            set.set_range('0', '9');
+            set.set_range('a', 'z');
+            set.set_range('A', 'Z');
+            set.set('_');
+            break;
+
+        case CharT{'S'}:
+            invert = true;
+            [[fallthrough]];
+        case CharT{'s'}:
+            set.set_range('\t', '\r');
+            set.set(' ');
+            break;
+
+        case CharT{'t'}:
+            set.set('\t');
+            break;
+        case CharT{'n'}:
+            set.set('\n');
+            break;
+        case CharT{'v'}:
+            set.set('\v');
+            break;
+        case CharT{'f'}:
+            set.set('\f');
+            break;
+        case CharT{'r'}:
+            set.set('\r');
+            break;
+
+        default: {
+            // Escaped ASCII punctuation matches itself,
+            // other escape sequences aren't supported
+            const auto u = static_cast<std::make_unsigned_t<CharT>>(ch);
+            if (u >= 128 || (u >= '0' && u <= '9') || (u >= 'a' && u <= 'z') ||
+                (u >= 'A' && u <= 'Z') || u <= ' ') {
+                return false;
+            }
+            set.set(static_cast<unsigned>(u));
+            break;
+        }
+    }
+
+    if (invert) {
+        set.invert();
+    }
+    atom.ascii[0] |= set.ascii[0];
+    atom.ascii[1] |= set.ascii[1];
+    atom.nonascii |= set.nonascii;
+    return true;
+}
+
+// Parses a bracketed set, `i` points to after the opening `[`
+template <typename CharT>
+constexpr bool parse_ct_regex_set(std::basic_string_view<CharT> pattern,
+                                  std::size_t& i,
+                                  ct_regex_atom& atom)
+{
+    bool invert = false;
+    if (i < pattern.size() && pattern[i] == CharT{'^'}) {
+        invert = true;
+        ++i;
+    }
+    if (i < pattern.size() && pattern[i] == CharT{']'}) {
+        // Empty set
+        return false;
+    }
+
+    // Returns the single code unit at `i`, or -1 if it's not one
+    const auto parse_single = [&]() -> int {
+        const auto ch = pattern[i++];
+        const auto u = static_cast<std::make_unsigned_t<CharT>>(ch);
+        if (u >= 128 || ch == CharT{'['}) {
+            return -2;
+        }
+        if (ch != CharT{'\\'}) {
+            return static_cast<int>(u);
+        }
+        if (i == pattern.size()) {
+            return -2;
+        }
+        ct_regex_atom tmp{};
+        if (!parse_ct_regex_escape(pattern[i++], tmp)) {
+            return -2;
+        }
+        atom.ascii[0] |= tmp.ascii[0];
+        atom.ascii[1] |= tmp.ascii[1];
+        atom.nonascii |= tmp.nonascii;
+        if (!tmp.nonascii && (tmp.ascii[0] & (tmp.ascii[0] - 1)) == 0 &&
+            (tmp.ascii[1] & (tmp.ascii[1] - 1)) == 0 &&
+            ((tmp.ascii[0] == 0) != (tmp.ascii[1] == 0))) {
+            // A single code unit, can be used in a range
+            for (unsigned c = 0; c < 128; ++c) {
+                if (tmp.test(c)) {
+                    return static_cast<int>(c);
+                }
+            }
+        }
+        return -1;
+    };
+
+    while (i < pattern.size() && pattern[i] != CharT{']'}) {
+        const auto first = parse_single();
+        if (first == -2) {
+            return false;
+        }
+        if (i + 1 < pattern.size() && pattern[i] == CharT{'-'} &&
+            pattern[i + 1] != CharT{']'}) {
+            ++i;
+            const auto last = parse_single();
+            if (first < 0 || last < 0 || last < first) {
+                return false;
+            }
+            atom.set_range(static_cast<unsigned>(first),
+                           static_cast<unsigned>(last));
+            continue;
+        }
+        if (first >= 0) {
+            atom.set(static_cast<unsigned>(first));
+        }
+    }
+    if (i == pattern.size()) {
+        return false;
+    }
+    ++i;
+
+    if (invert) {
+        atom.invert();
+    }
+    return true;
+}
+
+// Parses the number in a {n,m} quantifier
+template <typename CharT>
+constexpr std::size_t parse_ct_regex_count(
+    std::basic_string_view<CharT> pattern,
+    std::size_t& i)
+{
+    std::size_t n = 0;
+    const auto start = i;
+    for (; i < pattern.size() && pattern[i] >= CharT{'0'} &&
+           pattern[i] <= CharT{'9'};
+         ++i) {
+        if (n > 100000) {
+            return ct_regex_unbounded;
+        }
+        n = n * 10 + static_cast<std::size_t>(pattern[i] - CharT{'0'});
+    }
+    return i == start ? ct_regex_unbounded : n;
+}
+
+/**
+ * Parses `pattern` into atoms, calling `on_atom` for each of them.
+ * Returns `false`, if `pattern` isn't supported by this engine.
+ */
+template <typename CharT, typename OnAtom>
+constexpr bool parse_ct_regex(std::basic_string_view<CharT> pattern,
+                              regex_flags flags,
+                              OnAtom&& on_atom)
+{
+    const bool nocase = (flags & regex_flags::nocase) != regex_flags::none;
+    const bool singleline =
+        (flags & regex_flags::singleline) != regex_flags::none;
+    constexpr bool supports_nonascii =
+        std::is_same_v<CharT, char> &&
+        SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD;
+
+    // Code units matched by the atoms with a variable repetition count,
+    // that could still be followed by the current atom
+    ct_regex_atom open_variable_atoms{};
+    // Whether one of those atoms overlaps with an atom following it
+    bool has_overlap = false;
+
+    std::size_t i = 0;
+    while (i < pattern.size()) {
+        ct_regex_atom atom{};
+
+        const auto ch = pattern[i++];
+        switch (ch) {
+            case CharT{'.'}:
+                atom.invert();
+                if (!singleline) {
+                    atom.ascii[0] &= ~(std::uint64_t{1} << '\n');
+                    atom.ascii[0] &= ~(std::uint64_t{1} << '\r');
+                }
+                break;
+
+            case CharT{'\\'}:
+                if (i == pattern.size() ||
+                    !parse_ct_regex_escape(pattern[i++], atom)) {
+                    return false;
+                }
+                break;
+
+            case CharT{'['}:
+                if (!parse_ct_regex_set(pattern, i, atom)) {
+                    return false;
+                }
+                break;
+
+            case CharT{'('}:
+            case CharT{')'}:
+            case CharT{'|'}:
+            case CharT{'^'}:
+            case CharT{'$'}:
+            case CharT{'*'}:
+            case CharT{'+'}:
+            case CharT{'?'}:
+            case CharT{'{'}:
+            case CharT{'}'}:
+            case CharT{']'}:
+                return false;
+
+            default: {
+                const auto u = static_cast<std::make_unsigned_t<CharT>>(ch);
+                if (u >= 128) {
+                    return false;
+                }
+                atom.set(static_cast<unsigned>(u));
+                break;
+            }
+        }
+
+        if (atom.nonascii && !supports_nonascii) {
+            return false;
+        }
+        if (nocase) {
+            if (atom.nonascii) {
+                // Negated sets: case-fold the set that isn't matched
+                atom.invert();
+                atom.add_other_case();
+                atom.invert();
+            }
+            else {
+                atom.add_other_case();
+            }
+        }
+
+        if (i < pattern.size()) {
+            switch (pattern[i]) {
+                case CharT{'*'}:
+                    atom.min = 0;
+                    atom.max = ct_regex_unbounded;
+                    ++i;
+                    break;
+                case CharT{'+'}:
+                    atom.max = ct_regex_unbounded;
+                    ++i;
+                    break;
+                case CharT{'?'}:
+                    atom.min = 0;
+                    ++i;
+                    break;
+                case CharT{'{'}: {
+                    ++i;
+                    atom.min = parse_ct_regex_count(pattern, i);
+                    if (atom.min == ct_regex_unbounded ||
+                        i == pattern.size()) {
+                        return false;
+                    }
+                    if (pattern[i] == CharT{','}) {
+                        ++i;
+                        atom.max = (i < pattern.size() && pattern[i] == '}')
+                                       ? ct_regex_unbounded
+                                       : parse_ct_regex_count(pattern, i);
+                        if (i == pattern.size() || atom.max < atom.min) {
+                            return false;
+                        }
+                    }
+                    else {
+                        atom.max = atom.min;
+                    }
+                    if (pattern[i] != CharT{'}'}) {
+                        return false;
+                    }
+                    ++i;
+                    break;
+                }
+                default:
+                    break;
+            }
+            if (i < pattern.size() &&
+                (pattern[i] == CharT{'?'} || pattern[i] == CharT{'*'} ||
+                 pattern[i] == CharT{'+'} || pattern[i] == CharT{'{'})) {
+                // Lazy quantifiers, or invalid repeated quantifiers
+                return false;
+            }
+        }
+
+        has_overlap = has_overlap || atom.intersects(open_variable_atoms);
+        if (has_overlap && atom.min != 0) {
+            // Can fail after an overlap, would need backtracking
+            return false;
+        }
+        if (atom.min != 0) {
+            open_variable_atoms = ct_regex_atom{};
+        }
+        if (atom.min != atom.max) {
+            open_variable_atoms.add(atom);
+        }
+
+        on_atom(atom);
+    }
+    return true;
+}
+
+template <typename CharT>
+constexpr std::size_t count_ct_regex_atoms(
+    std::basic_string_view<CharT> pattern,
+    regex_flags flags)
+{
+    std::size_t n = 0;
+    if (!parse_ct_regex(pattern, flags, [&](const ct_regex_atom&) { ++n; })) {
+        return 0;
+    }
+    return n;
+}
+
+template <std::size_t N>
+struct ct_regex {
+    std::array<ct_regex_atom, N> atoms{};
+
+    constexpr bool can_match_nonascii() const
+    {
+        for (const auto& atom : atoms) {
+            if (atom.nonascii) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Matches the regex at the beginning of `input`.
+     * Returns the length of the match, or `ct_regex_unbounded` if there's
+     * none.
+     */
+    template <typename CharT>
+    constexpr std::size_t match(std::basic_string_view<CharT> input) const
+    {
+        std::size_t pos = 0;
+        for (const auto& atom : atoms) {
+            const auto first = pos;
+            while (pos - first < atom.max && pos < input.size() &&
+                   atom.matches(input[pos])) {
+                ++pos;
+            }
+            if (pos - first < atom.min) {
+                return ct_regex_unbounded;
+            }
+        }
+        return pos;
+    }
+};
+
+template <std::size_t N, typename CharT>
+constexpr ct_regex<N> make_ct_regex(std::basic_string_view<CharT> pattern,
+                                    regex_flags flags)
+{
+    ct_regex<N> re{};
+    std::size_t n = 0;
+    parse_ct_regex(pattern, flags,
+                   [&](const ct_regex_atom& atom) { re.atoms[n++] = atom; });
+    return re;
+}
+
+#endif  // !SCN_DISABLE_REGEX
+
+enum class compiled_field_kind : unsigned char {
+    literal,        // non-whitespace literal text, matched exactly
+    whitespace,     // whitespace, skips all whitespace in the source
+    builtin_field,  // replacement field for a built-in type
+    custom_field,   // replacement field for a user-defined type
+    regex_field,    // string with a regex supported by ct_regex
+};
+
+/// A single element of a pre-parsed format string
+struct compiled_field {
+    compiled_field_kind kind{compiled_field_kind::literal};
+    std::size_t arg_id{0};
+    // literal text, or the format specs of a custom_field,
+    // as offsets into the format string
+    std::size_t begin{0};
+    std::size_t end{0};
+    bool has_specs{false};
+    format_specs specs{};
+};
+
+template <typename T, typename CharT, typename ParseCtx>
+constexpr const CharT* parse_compiled_field_specs(ParseCtx& parse_ctx,
+                                                  format_specs& specs)
+{
+    if constexpr (arg_type_constant<T, CharT>::value ==
+                  arg_type::custom_type) {
+        // Only used to find the end of the specs,
+        // scanner::parse is called again when scanning
+        return parse_format_specs<T, default_context<CharT>, ParseCtx>(
+            parse_ctx);
+    }
+    else {
+        return scanner_parse_for_builtin_type<T>(parse_ctx, specs);
+    }
+}
+
+/**
+ * Format string handler, turning a format string into an array of
+ * `compiled_field`s.
+ * If `N` is smaller than the number of fields, only counts them.
+ */
+template <typename CharT, typename Source, std::size_t N, typename... Args>
+class compiled_format_builder {
+public:
+    using parse_context_type = compile_parse_context<CharT>;
+    static constexpr auto num_args = sizeof...(Args);
+
+    explicit constexpr compiled_format_builder(
+        std::basic_string_view<CharT> format_str)
+        : m_format(format_str),
+          m_parse_context(source_tag<Source>, format_str, num_args, m_types),
+          m_parse_funcs{&parse_compiled_field_specs<Args, CharT,
+                                                    parse_context_type>...},
+          m_types{arg_type_constant<Args, CharT>::value...}
+    {
+    }
+
+    constexpr void on_literal_text(const CharT* begin, const CharT* end)
+    {
+        // Encoding has already been checked by format_string_checker
+        while (begin != end) {
+            const auto len = code_point_length_by_starting_code_unit(*begin);
+            const auto cp = decode_code_point_exhaustive(
+                std::basic_string_view<CharT>{begin, len});
+            const auto kind = is_cp_space(cp) ? compiled_field_kind::whitespace
+                                              : compiled_field_kind::literal;
+            const auto offset = get_offset(begin);
+            begin += len;
+
+            // Merge consecutive whitespace, and adjacent literal text
+            if (m_count != 0 && m_last_kind == kind &&
+                (kind == compiled_field_kind::whitespace ||
+                 m_last_end == offset)) {
+                m_last_end = get_offset(begin);
+                if (m_count <= N) {
+                    m_fields[m_count - 1].end = m_last_end;
+                }
+                continue;
+            }
+            push_field({kind, 0, offset, get_offset(begin), false, {}});
+        }
+    }
+
+    constexpr auto on_arg_id()
+    {
+        return m_parse_context.next_arg_id();
+    }
+    constexpr auto on_arg_id(std::size_t id)
+    {
+        m_parse_context.check_arg_id(id);
+        return id;
+    }
+
+    constexpr void on_replacement_field(std::size_t id, const CharT* begin)
+    {
+        push_field({get_field_kind(id), id, get_offset(begin),
+                    get_offset(begin), false, {}});
+    }
+
+    constexpr const CharT* on_format_specs(std::size_t id,
+                                           const CharT* begin,
+                                           const CharT*)
+    {
+        auto field = compiled_field{get_field_kind(id), id, get_offset(begin),
+                                    get_offset(begin), true, {}};
+        m_parse_context.advance_to(begin);
+        const auto it = m_parse_funcs[id](m_parse_context, field.specs);
+        field.end = get_offset(it);
+#if !SCN_DISABLE_REGEX
+        if (is_ct_regex_field(id, field.specs)) {
+            field.kind = compiled_field_kind::regex_field;
+        }
+#endif
+        push_field(field);
+        return it;
+    }
+
+    constexpr void check_args_exhausted() {}
+
+    void on_error(const char* msg)
+    {
+        SCN_UNLIKELY_ATTR
+        m_parse_context.on_error(msg);
+    }
+
+    constexpr scan_expected<void> get_error() const
+    {
+        return {};
+    }
+
+    constexpr std::size_t count() const
+    {
+        return m_count;
+    }
+
+    constexpr std::array<compiled_field, N> fields() const
+    {
+        return m_fields;
+    }
+
+private:
+    constexpr std::size_t get_offset(const CharT* it) const
+    {
+        return static_cast<std::size_t>(it - m_format.data());
+    }
+
+    constexpr compiled_field_kind get_field_kind(std::size_t id) const
+    {
+        return m_types[id] == arg_type::custom_type
+                   ? compiled_field_kind::custom_field
+                   : compiled_field_kind::builtin_field;
+    }
+
+#if !SCN_DISABLE_REGEX
+    // Whether the field is a string read with a regex,
+    // that can be matched with ct_regex, instead of the regex backend
+    constexpr bool is_ct_regex_field(std::size_t id,
+                                     const format_specs& specs) const
+    {
+        constexpr auto string_type = std::is_same_v<CharT, char>
+                                         ? arg_type::narrow_string_type
+                                         : arg_type::wide_string_type;
+        if (m_types[id] != arg_type::string_view_type &&
+            m_types[id] != string_type) {
+            return false;
+        }
+        if (specs.type != presentation_type::regex &&
+            specs.type != presentation_type::regex_escaped) {
+            return false;
+        }
+        if (specs.width != 0 || specs.precision != 0 ||
+            specs.align != align_type::none) {
+            return false;
+        }
+        return count_ct_regex_atoms(specs.get_charset_string<CharT>(),
+                                    specs.regexp_flags) != 0;
+    }
+#endif
+
+    constexpr void push_field(const compiled_field& field)
+    {
+        if (m_count < N) {
+            m_fields[m_count] = field;
+        }
+        ++m_count;
+        m_last_kind = field.kind;
+        m_last_end = field.end;
+    }
+
+    using parse_func = const CharT* (*)(parse_context_type&, format_specs&);
+
+    std::basic_string_view<CharT> m_format;
+    parse_context_type m_parse_context;
+    parse_func m_parse_funcs[num_args > 0 ? num_args : 1];
+    arg_type m_types[num_args > 0 ? num_args : 1];
+    std::array<compiled_field, N> m_fields{};
+    std::size_t m_count{0};
+    compiled_field_kind m_last_kind{compiled_field_kind::literal};
+    std::size_t m_last_end{0};
+};
+
+template <typename CharT, typename Source, typename... Args>
+constexpr std::size_t count_compiled_fields(
+    std::basic_string_view<CharT> format_str)
+{
+    auto builder =
+        compiled_format_builder<CharT, Source, 0, Args...>(format_str);
+    parse_format_string_impl<true>(format_str, builder);
+    return builder.count();
+}
+
+template <typename CharT, typename Source, std::size_t N, typename... Args>
+constexpr std::array<compiled_field, N> make_compiled_fields(
+    std::basic_string_view<CharT> format_str)
+{
+    auto builder =
+        compiled_format_builder<CharT, Source, N, Args...>(format_str);
+    parse_format_string_impl<true>(format_str, builder);
+    return builder.fields();
+}
+
+/**
+ * The format string `Str`, parsed at compile time into a fixed sequence
+ * of literals and replacement fields, with argument IDs resolved and
+ * format specs parsed.
+ */
+template <typename Str, typename Source, typename... Args>
+struct compiled_format {
+    using char_type = typename Str::char_type;
+
+    SCN_GCC_PUSH
+    SCN_GCC_IGNORE("-Wconversion")
+    static constexpr auto format = std::basic_string_view<char_type>{Str{}};
+    SCN_GCC_POP
+
+    static constexpr std::size_t size =
+        count_compiled_fields<char_type, Source, Args...>(format);
+    static constexpr std::array<compiled_field, size> fields =
+        make_compiled_fields<char_type, Source, size, Args...>(format);
+};
+}  // namespace detail
+
+namespace detail {
+template <typename Context>
+scan_expected<void> scan_compiled_literal(
+    Context& ctx,
+    std::basic_string_view<typename Context::char_type> literal)
+{
+    auto it = ctx.begin();
+    if (!it.stores_parent()) {
+        // Contiguous source: compare the entire literal at once
+        const auto segment = it.contiguous_segment();
+        const auto n = (std::min)(segment.size(), literal.size());
+        if (SCN_UNLIKELY(segment.substr(0, n) != literal.substr(0, n))) {
+            return unexpected_scan_error(
+                scan_error::invalid_literal,
+                "Unexpected literal character in source");
+        }
+        if (SCN_UNLIKELY(n != literal.size())) {
+            return unexpected_scan_error(scan_error::invalid_literal,
+                                         "Unexpected end of source");
+        }
+        ctx.advance_to(it.batch_advance(static_cast<std::ptrdiff_t>(n)));
+        return {};
+    }
+
+    for (auto ch : literal) {
+        if (SCN_UNLIKELY(it == ctx.end())) {
+            return unexpected_scan_error(scan_error::invalid_literal,
+                                         "Unexpected end of source");
+        }
+        if (SCN_UNLIKELY(*it != ch)) {
+            return unexpected_scan_error(
+                scan_error::invalid_literal,
+                "Unexpected literal character in source");
+        }
+        ++it;
+    }
+    ctx.advance_to(SCN_MOVE(it));
+    return {};
+}
+
+#if !SCN_DISABLE_REGEX
+template <typename Compiled, std::size_t I>
+inline constexpr auto compiled_regex = make_ct_regex<count_ct_regex_atoms(
+    Compiled::fields[I].specs.template get_charset_string<
+        typename Compiled::char_type>(),
+    Compiled::fields[I].specs.regexp_flags)>(
+    Compiled::fields[I].specs.template get_charset_string<
+        typename Compiled::char_type>(),
+    Compiled::fields[I].specs.regexp_flags);
+
+template <typename Compiled, std::size_t I, typename Context, typename T>
+scan_expected<void> scan_compiled_regex_field(Context& ctx, T& value)
+{
+    using char_type = typename Context::char_type;
+    constexpr auto& field = Compiled::fields[I];
+
+    auto it = ctx.begin();
+    if (it.stores_parent()) {
+        // Not contiguous, use the regex backend
+        SCN_TRY(result, scanner_scan_for_builtin_type(value, ctx, field.specs));
+        ctx.advance_to(SCN_MOVE(result));
+        return {};
+    }
+
+    const auto segment = it.contiguous_segment();
+    const auto n = compiled_regex<Compiled, I>.match(segment);
+    if (SCN_UNLIKELY(n == ct_regex_unbounded)) {
+        return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                     "Regular expression didn't match");
+    }
+
+    const auto match = segment.substr(0, n);
+    if constexpr (compiled_regex<Compiled, I>.can_match_nonascii()) {
+        // Non-ASCII input needs to be checked for valid encoding:
+        // leave that to the regex backend
+        for (auto ch : match) {
+            if (static_cast<std::make_unsigned_t<char_type>>(ch) >= 128) {
+                SCN_TRY(result, scanner_scan_for_builtin_type(value, ctx,
+                                                              field.specs));
+                ctx.advance_to(SCN_MOVE(result));
+                return {};
+            }
+        }
+    }
+    if constexpr (std::is_same_v<T, std::basic_string_view<char_type>>) {
+        value = match;
+    }
+    else {
+        value.assign(match.data(), match.size());
+    }
+    ctx.advance_to(it.batch_advance(static_cast<std::ptrdiff_t>(n)));
+    return {};
+}
+#endif
+
+template <typename Compiled,
+          typename Source,
+          std::size_t I,
+          typename Context,
+          typename... Args>
+scan_expected<void> scan_compiled_field(Context& ctx,
+                                        std::tuple<Args...>& values)
+{
+    using char_type = typename Context::char_type;
+    constexpr auto& field = Compiled::fields[I];
+
+    if constexpr (field.kind == compiled_field_kind::literal) {
+        return scan_compiled_literal(
+            ctx, Compiled::format.substr(field.begin, field.end - field.begin));
+    }
+    else if constexpr (field.kind == compiled_field_kind::whitespace) {
+        if (SCN_UNLIKELY(ctx.begin() == ctx.end())) {
+            return unexpected_scan_error(scan_error::invalid_literal,
+                                         "Unexpected end of source");
+        }
+        SCN_TRY(it, internal_skip_classic_whitespace(ctx.range(), true));
+        ctx.advance_to(SCN_MOVE(it));
+        return {};
+    }
+    else if constexpr (field.kind == compiled_field_kind::builtin_field) {
+        SCN_TRY(it, scanner_scan_for_builtin_type(
+                        std::get<field.arg_id>(values), ctx, field.specs));
+        ctx.advance_to(SCN_MOVE(it));
+        return {};
+    }
+#if !SCN_DISABLE_REGEX
+    else if constexpr (field.kind == compiled_field_kind::regex_field) {
+        return scan_compiled_regex_field<Compiled, I>(
+            ctx, std::get<field.arg_id>(values));
+    }
+#endif
+    else {
+        auto& value = std::get<field.arg_id>(values);
+        using value_type = remove_cvref_t<decltype(value)>;
+
+        auto s = typename Context::template scanner_type<value_type>{};
+        auto pctx = typename Context::parse_context_type{
+            source_tag<Source>,
+            field.has_specs ? Compiled::format.substr(field.begin)
+                            : std::basic_string_view<char_type>{}};
+        SCN_TRY_DISCARD(parse_custom_arg(value, s, pctx));
+        SCN_TRY(it, s.scan(value, ctx));
+        ctx.advance_to(SCN_MOVE(it));
+        return {};
+    }
+}
+
+template <typename Compiled,
+          typename Source,
+          typename Context,
+          typename Tuple,
+          std::size_t... Is>
+scan_expected<void> scan_compiled_fields(Context& ctx,
+                                         Tuple& values,
+                                         std::index_sequence<Is...>)
+{
+    scan_expected<void> result{};
+    static_cast<void>(
+        ((result = scan_compiled_field<Compiled, Source, Is>(ctx, values)) &&
+         ...));
+    return result;
+}
+
+template <typename CharT>
+auto get_compiled_scan_range(basic_scan_buffer<CharT>& buffer)
+{
+    return buffer.get();
+}
+template <typename CharT>
+auto get_compiled_scan_range(std::basic_string_view<CharT> source)
+{
+    using iterator = typename basic_scan_buffer<CharT>::iterator;
+    return typename basic_scan_buffer<CharT>::range_type{
+        iterator{source, 0}, ranges::default_sentinel};
+}
+template <typename Range,
+          std::enable_if_t<ranges::forward_range<Range>>* = nullptr>
+auto get_compiled_scan_range(Range r)
+{
+    return r;
+}
+
+template <typename Compiled, typename Source, typename Range, typename Tuple>
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(Range source, Tuple& values)
+{
+    using context_type = default_context<typename Compiled::char_type>;
+
+    const auto begin_position = source.begin().position();
+    auto do_scan = [&]() -> scan_expected<std::ptrdiff_t> {
+        auto ctx = context_type{source, {}};
+        SCN_TRY_DISCARD((scan_compiled_fields<Compiled, Source>(
+            ctx, values, std::make_index_sequence<Compiled::size>{})));
+        return ctx.begin().position();
+    };
+
+    if (!source.begin().stores_parent()) {
+        SCN_TRY(end_position, do_scan());
+        return end_position - begin_position;
+    }
+
+    auto& buffer = *source.begin().parent();
+    if (auto e = buffer.get_source_error(); SCN_UNLIKELY(!e)) {
+        return unexpected(e.error());
+    }
+
+    auto end_position = do_scan();
+    if (SCN_UNLIKELY(
+            !buffer.sync(end_position ? *end_position : begin_position))) {
+        return unexpected_scan_error(scan_error::invalid_source_state,
+                                     "Failed to sync with underlying source");
+    }
+    if (auto e = buffer.get_source_error(); SCN_UNLIKELY(!e)) {
+        return unexpected(e.error());
+    }
+    if (SCN_UNLIKELY(!end_position)) {
+        return unexpected(end_position.error());
+    }
+    return *end_position - begin_position;
+}
+
+template <typename Compiled, typename Source, typename Tuple>
+auto vscan_compiled(Source&& source, Tuple& values) -> vscan_result<Source>
+{
+    vscan_guard<remove_cvref_t<Source>> guard{};
+    SCN_UNUSED(guard);
+
+    auto&& buffer = make_scan_buffer(source);
+    auto result = vscan_compiled_impl<Compiled, Source>(
+        get_compiled_scan_range(buffer), values);
+    if (SCN_UNLIKELY(!result)) {
+        return unexpected(result.error());
+    }
+    return make_vscan_result(SCN_FWD(source), buffer, *result);
+}
+}  // namespace detail
+
+/**
+ * Compile-time compiled format string.
+ *
+ * In addition to being checked at compile time, like `SCN_STRING`,
+ * the format string is turned into a fixed sequence of
+ * literals and replacement fields,
+ * which are then scanned with statically typed calls to the `scanner`s of the
+ * arguments. No parsing of the format string happens at runtime.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<int, int>("123 abc", SCN_COMPILE("{} {:x}"));
+ * // result->values() == (123, 0xabc)
+ * \endcode
+ *
+ * Not supported with the localized overloads of `scan`.
+ *
+ * \ingroup format-string
+ */
+#define SCN_COMPILE(s) SCN_STRING_IMPL(s, ::scn::detail::compiled_string, )
+
 /////////////////////////////////////////////////////////////////
 // scan
 /////////////////////////////////////////////////////////////////
@@ -12235,6 +13237,64 @@ SCN_NODISCARD auto scan(Source&& source,
     return result;
 }
 
+/**
+ * `scan` with a format string compiled with `SCN_COMPILE`.
+ *
+ * The arguments are scanned without type erasure,
+ * and without parsing the format string at runtime.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<int, std::string>("42 foo", SCN_COMPILE("{} {}"));
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename Str,
+          typename = std::enable_if_t<
+              detail::is_compiled_string_v<Str> &&
+              detail::is_source_impl<typename Str::char_type, Source>>>
+SCN_NODISCARD auto scan(Source&& source, Str format)
+    -> scan_result_type<Source, Args...>
+{
+    detail::check_format_string<Source, Args...>(format);
+
+    auto result = make_scan_result<Source, Args...>();
+    fill_scan_result(
+        result,
+        detail::vscan_compiled<detail::compiled_format<Str, Source, Args...>,
+                               Source>(SCN_FWD(source), result->values()));
+    return result;
+}
+
+/**
+ * `scan` with a format string compiled with `SCN_COMPILE`,
+ * and explicitly supplied default values.
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename Str,
+          typename = std::enable_if_t<
+              detail::is_compiled_string_v<Str> &&
+              detail::is_source_impl<typename Str::char_type, Source>>>
+SCN_NODISCARD auto scan(Source&& source,
+                        Str format,
+                        std::tuple<Args...>&& initial_args)
+    -> scan_result_type<Source, Args...>
+{
+    detail::check_format_string<Source, Args...>(format);
+
+    auto result = make_scan_result<Source>(SCN_MOVE(initial_args));
+    fill_scan_result(
+        result,
+        detail::vscan_compiled<detail::compiled_format<Str, Source, Args...>,
+                               Source>(SCN_FWD(source), result->values()));
+    return result;
+}
+
 /**
  * \defgroup locale Localization
  *
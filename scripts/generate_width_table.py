@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+
+# Copyright 2017 Elias Kosunen
+# SPDX-License-Identifier: Apache-2.0
+
+# Generates src/scn/impl_width_table.h, the two-stage lookup table used for
+# calculating the text width of code points (see calculate_text_width in
+# src/scn/impl.h), from the Unicode Character Database file EastAsianWidth.txt.
+#
+# A code point has a width of 2, if its East_Asian_Width property is W or F,
+# or it's in one of the extra ranges listed below (as specified by
+# [format.string.std] in the C++ standard). Otherwise, its width is 1.
+
+import sys
+import re
+import urllib.request
+from argparse import ArgumentParser
+from pathlib import Path
+
+EAW_URL = r'https://www.unicode.org/Public/UCD/latest/ucd/EastAsianWidth.txt'
+
+# Code points beyond this all have a width of 1, and aren't stored in the table
+TABLE_END = 0x40000
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+EXTRA_WIDE_RANGES = [
+    (0x4DC0, 0x4DFF),  # Yijing Hexagram Symbols
+    (0x1F300, 0x1F5FF),  # Miscellaneous Symbols and Pictographs
+    (0x1F900, 0x1F9FF),  # Supplemental Symbols and Pictographs
+]
+
+
+def read_text_file(path):
+    print(rf'Reading {path}')
+    with open(path, r'r', encoding=r'utf-8') as f:
+        return f.read()
+
+
+def write_text_file(path, text):
+    print(rf'Writing {path}')
+    with open(path, r'w', encoding=r'utf-8', newline='\n') as f:
+        f.write(text)
+
+
+def parse_range(text):
+    first, _, last = text.strip().partition(r'..')
+    first = int(first, 16)
+    return first, int(last, 16) if last else first
+
+
+def parse_east_asian_width(text):
+    """Returns the Unicode version, and a list of widths, indexed by code point"""
+    version = re.search(r'EastAsianWidth-([0-9.]+)\.txt', text)
+    version = version[1] if version else r'unknown'
+
+    wide = [False] * TABLE_END
+
+    def assign(first, last, prop):
+        for cp in range(first, min(last + 1, TABLE_END)):
+            wide[cp] = prop in (r'W', r'F')
+
+    # Default values for unlisted code points,
+    # listed first so that explicit entries override them
+    for line in text.splitlines():
+        missing = re.match(r'#\s*@missing:\s*([0-9A-Fa-f.]+)\s*;\s*(\w+)', line)
+        if missing:
+            assign(*parse_range(missing[1]), missing[2])
+
+    for line in text.splitlines():
+        line = line.partition(r'#')[0].strip()
+        if not line:
+            continue
+        cps, _, prop = line.partition(r';')
+        assign(*parse_range(cps), prop.strip())
+
+    return version, wide
+
+
+def east_asian_width_from_unicodedata():
+    """Fallback for offline use: uses the Unicode database of this Python"""
+    import unicodedata
+    wide = [unicodedata.east_asian_width(chr(cp)) in (r'W', r'F')
+            for cp in range(TABLE_END)]
+    # Unassigned code points default to N,
+    # except in these ranges, where they default to W (UAX #11)
+    default_wide = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+                    (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+    for cp in range(TABLE_END):
+        if unicodedata.category(chr(cp)) == r'Cn':
+            wide[cp] = any(first <= cp <= last for first, last in default_wide)
+    return unicodedata.unidata_version, wide
+
+
+def make_tables(wide):
+    for first, last in EXTRA_WIDE_RANGES:
+        for cp in range(first, last + 1):
+            wide[cp] = True
+
+    blocks = []
+    block_indices = {}
+    stage1 = []
+    for start in range(0, TABLE_END, BLOCK_SIZE):
+        bits = [0] * (BLOCK_SIZE // 8)
+        for i in range(BLOCK_SIZE):
+            if wide[start + i]:
+                bits[i // 8] |= 1 << (i % 8)
+        bits = tuple(bits)
+        if bits not in block_indices:
+            block_indices[bits] = len(blocks)
+            blocks.append(bits)
+        stage1.append(block_indices[bits])
+
+    assert len(blocks) <= 256
+    return stage1, blocks
+
+
+def format_values(values, indent, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + r', '.join(values[i:i + per_line]) + r',')
+    return '\n'.join(lines)
+
+
+def make_header(version, stage1, blocks):
+    stage2 = [rf'0x{b:02x}' for block in blocks for b in block]
+    return rf'''// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+// This file is generated by scripts/generate_width_table.py,
+// from the East_Asian_Width property of Unicode {version}. Do not edit.
+
+#pragma once
+
+#include <cstdint>
+
+namespace scn {{
+SCN_BEGIN_NAMESPACE
+
+namespace impl::width_table {{
+
+// Code points at or beyond this have a width of 1
+inline constexpr char32_t end = 0x{TABLE_END:x};
+inline constexpr unsigned block_shift = {BLOCK_SHIFT};
+
+// Index into `blocks`, for every block of {BLOCK_SIZE} code points
+inline constexpr std::uint8_t stage1[{len(stage1)}] = {{
+{format_values([str(i) for i in stage1], '    ', 16)}
+}};
+
+// Bitmaps of {BLOCK_SIZE} bits, a set bit marks a double-wide code point
+inline constexpr std::uint8_t blocks[{len(blocks)}][{BLOCK_SIZE // 8}] = {{
+{format_values(stage2, '    ', 8)}
+}};
+
+}}  // namespace impl::width_table
+
+SCN_END_NAMESPACE
+}}  // namespace scn
+'''
+
+
+if __name__ == '__main__':
+    args = ArgumentParser(r'generate_width_table.py',
+                          description=r'Generates the text width lookup table from EastAsianWidth.txt.')
+    source = args.add_mutually_exclusive_group()
+    source.add_argument(r'--input', type=Path,
+                        help=rf'Path to EastAsianWidth.txt (default: download from {EAW_URL})')
+    source.add_argument(r'--use-python-unicodedata', action=r'store_true',
+                        help=r'Use the Unicode database bundled with this Python, instead of EastAsianWidth.txt')
+    args.add_argument(r'--output', type=Path,
+                      default=Path(__file__).resolve().parent.parent / r'src' / r'scn' / r'impl_width_table.h')
+    args = args.parse_args()
+
+    if args.use_python_unicodedata:
+        version, wide = east_asian_width_from_unicodedata()
+    elif args.input:
+        version, wide = parse_east_asian_width(read_text_file(args.input))
+    else:
+        print(rf'Downloading {EAW_URL}')
+        with urllib.request.urlopen(EAW_URL) as response:
+            version, wide = parse_east_asian_width(response.read().decode(r'utf-8'))
+
+    stage1, blocks = make_tables(wide)
+    write_text_file(args.output, make_header(version, stage1, blocks))
+    sys.exit(0)
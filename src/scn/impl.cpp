@@ -18,7 +18,9 @@
 #include <scn/chrono.h>
 #include <scn/impl.h>
 #include <scn/istream.h>
+#include <scn/parsed_format.h>
 
+#include <atomic>
 #include <mutex>
 
 #if !SCN_DISABLE_LOCALE
@@ -263,8 +265,61 @@ scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
     template SCN_PUBLIC scan_expected<Context::iterator> \
     scanner_scan_for_builtin_type(T&, Context&, const format_specs&);
 
+#if SCN_HAS_INT128
+#define SCN_DEFINE_SCANNER_SCAN_FOR_INT128(Context)   \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(int128, Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(uint128, Context)
+#else
+#define SCN_DEFINE_SCANNER_SCAN_FOR_INT128(Context) /* int128 */
+#endif
+
+#if SCN_HAS_STD_F16
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F16(Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(std::float16_t, Context)
+#else
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F16(Context) /* std::float16_t */
+#endif
+
+#if SCN_HAS_STD_F32
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F32(Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(std::float32_t, Context)
+#else
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F32(Context) /* std::float32_t */
+#endif
+
+#if SCN_HAS_STD_F64
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F64(Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(std::float64_t, Context)
+#else
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F64(Context) /* std::float64_t */
+#endif
+
+#if SCN_HAS_STD_F128
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F128(Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(std::float128_t, Context)
+#else
+#define SCN_DEFINE_SCANNER_SCAN_FOR_F128(Context) /* std::float128_t */
+#endif
+
+#if SCN_HAS_STD_BF16
+#define SCN_DEFINE_SCANNER_SCAN_FOR_BF16(Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(std::bfloat16_t, Context)
+#else
+#define SCN_DEFINE_SCANNER_SCAN_FOR_BF16(Context) /* std::bfloat16_t */
+#endif
+
+#define SCN_DEFINE_SCANNER_SCAN_FOR_EXT_FLOAT(Context) \
+    SCN_DEFINE_SCANNER_SCAN_FOR_F16(Context)           \
+    SCN_DEFINE_SCANNER_SCAN_FOR_F32(Context)           \
+    SCN_DEFINE_SCANNER_SCAN_FOR_F64(Context)           \
+    SCN_DEFINE_SCANNER_SCAN_FOR_F128(Context)          \
+    SCN_DEFINE_SCANNER_SCAN_FOR_BF16(Context)
+
 #define SCN_DEFINE_SCANNER_SCAN_FOR_CTX(Context)                               \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(Context::char_type, Context)              \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(char32_t, Context)                        \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(bool, Context)                            \
+    SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(void*, Context)                           \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(signed char, Context)                     \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(short, Context)                           \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(int, Context)                             \
@@ -284,6 +339,8 @@ scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(std::wstring_view, Context)               \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(regex_matches, Context)                   \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(wregex_matches, Context)                  \
+    SCN_DEFINE_SCANNER_SCAN_FOR_INT128(Context)                                \
+    SCN_DEFINE_SCANNER_SCAN_FOR_EXT_FLOAT(Context)                             \
     template SCN_PUBLIC scan_expected<ranges::iterator_t<Context::range_type>> \
     internal_skip_classic_whitespace(Context::range_type, bool);
 
@@ -441,6 +498,87 @@ template SCN_PUBLIC auto locale_ref::get() const -> std::locale;
 
 #endif
 
+/////////////////////////////////////////////////////////////////
+// regex_ref implementations
+/////////////////////////////////////////////////////////////////
+
+#if !SCN_DISABLE_REGEX
+
+namespace detail {
+template <typename CharT>
+template <typename Regex>
+basic_regex_handle<CharT>::basic_regex_handle(const Regex& re) : m_regex(&re)
+{
+    static_assert(std::is_same_v<Regex, impl::regex_type<CharT>>);
+}
+
+template <typename CharT, typename T>
+auto scan_regex_ref(basic_regex_handle<CharT> regex,
+                    T& value,
+                    default_context<CharT>& ctx)
+    -> scan_expected<typename default_context<CharT>::iterator>
+{
+    if (!regex.get()) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "No regex given in regex_ref");
+    }
+
+    if constexpr (!SCN_REGEX_SUPPORTS_WIDE_STRINGS &&
+                  !std::is_same_v<CharT, char>) {
+        return unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "Regex backend doesn't support wide strings as input");
+    }
+    else {
+        const auto& re =
+            *static_cast<const impl::regex_type<CharT>*>(regex.get());
+        auto range = ctx.range();
+
+        if constexpr (std::is_same_v<T, basic_regex_matches<CharT>>) {
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST && !SCN_REGEX_BOOST_USE_ICU
+            const auto pattern = re.str();
+#else
+            const auto pattern = std::basic_string<CharT>{};
+#endif
+            return impl::match_regex_matches<CharT>(
+                re, std::basic_string_view<CharT>{pattern}, range, value);
+        }
+        else {
+            SCN_TRY(it, impl::match_regex_string<CharT>(re, range));
+            if constexpr (std::is_same_v<T, std::basic_string<CharT>>) {
+                return impl::read_string_impl(range, it, value);
+            }
+            else {
+                return impl::read_string_view_impl(range, it, value);
+            }
+        }
+    }
+}
+
+template SCN_PUBLIC basic_regex_handle<char>::basic_regex_handle(
+    const impl::regex_type<char>&);
+#if SCN_REGEX_SUPPORTS_WIDE_STRINGS
+template SCN_PUBLIC basic_regex_handle<wchar_t>::basic_regex_handle(
+    const impl::regex_type<wchar_t>&);
+#endif
+
+#define SCN_DEFINE_SCAN_REGEX_REF(CharT, T)                               \
+    template SCN_PUBLIC auto scan_regex_ref(basic_regex_handle<CharT>, T&, \
+                                            default_context<CharT>&)    \
+        -> scan_expected<default_context<CharT>::iterator>;
+
+SCN_DEFINE_SCAN_REGEX_REF(char, std::string)
+SCN_DEFINE_SCAN_REGEX_REF(char, std::string_view)
+SCN_DEFINE_SCAN_REGEX_REF(char, regex_matches)
+SCN_DEFINE_SCAN_REGEX_REF(wchar_t, std::wstring)
+SCN_DEFINE_SCAN_REGEX_REF(wchar_t, std::wstring_view)
+SCN_DEFINE_SCAN_REGEX_REF(wchar_t, wregex_matches)
+
+#undef SCN_DEFINE_SCAN_REGEX_REF
+}  // namespace detail
+
+#endif
+
 namespace detail {
 SCN_PUBLIC scan_error handle_error(scan_error e)
 {
@@ -2560,6 +2698,95 @@ scan_expected<std::ptrdiff_t> scan_simple_single_argument(
     return it.position();
 }
 
+// Format string consisting only of default replacement fields ("{}"),
+// separated by whitespace, with a replacement field for every argument.
+template <typename CharT>
+constexpr bool is_simple_multiple_argument_format_string(
+    std::basic_string_view<CharT> format,
+    std::size_t argcount)
+{
+    std::size_t fields = 0;
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        if (format[i] == CharT{'{'}) {
+            if (i + 1 == format.size() || format[i + 1] != CharT{'}'}) {
+                return false;
+            }
+            ++fields;
+            ++i;
+        }
+        else if (!impl::is_ascii_space(format[i])) {
+            return false;
+        }
+    }
+    return fields == argcount;
+}
+
+template <typename Context, typename Range, typename CharT>
+scan_expected<ranges::iterator_t<Range>> scan_simple_multiple_arguments_impl(
+    Range source,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<detail::default_context<CharT>> args,
+    detail::locale_ref loc)
+{
+    auto it = source.begin();
+    std::size_t arg_id = 0;
+
+    for (std::size_t i = 0; i < format.size();) {
+        if (format[i] == CharT{'{'}) {
+            auto reader = impl::default_arg_reader<Context>{
+                ranges::subrange{it, source.end()}, args, loc};
+            SCN_TRY_ASSIGN(it, args.get(arg_id).visit(SCN_MOVE(reader)));
+            ++arg_id;
+            i += 2;
+            continue;
+        }
+
+        // Whitespace in the format string:
+        // skip all whitespace in the source, like format_handler
+        if (impl::is_range_eof(it, source.end())) {
+            SCN_UNLIKELY_ATTR
+            return detail::unexpected_scan_error(scan_error::invalid_literal,
+                                                 "Unexpected end of source");
+        }
+        it = impl::read_while_classic_space(ranges::subrange{it, source.end()});
+        while (i < format.size() && format[i] != CharT{'{'}) {
+            ++i;
+        }
+    }
+    return it;
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> scan_simple_multiple_arguments(
+    std::basic_string_view<CharT> source,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<detail::default_context<CharT>> args,
+    detail::locale_ref loc = {})
+{
+    SCN_TRY(it,
+            scan_simple_multiple_arguments_impl<
+                impl::basic_contiguous_scan_context<CharT>>(
+                ranges::subrange<const CharT*>{source.data(),
+                                               source.data() + source.size()},
+                format, SCN_MOVE(args), loc));
+    return ranges::distance(source.data(), it);
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> scan_simple_multiple_arguments(
+    typename detail::basic_scan_buffer<
+        detail::type_identity_t<CharT>>::range_type source,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<detail::default_context<CharT>> args,
+    detail::locale_ref loc = {})
+{
+    SCN_EXPECT(source.begin().stores_parent());
+    SCN_TRY(it, scan_simple_multiple_arguments_impl<
+                    detail::default_context<CharT>>(source, format,
+                                                    SCN_MOVE(args), loc));
+    return it.position();
+}
+
 template <typename Context, typename ID, typename Handler>
 auto get_arg(Context& ctx, ID id, Handler& handler)
 {
@@ -2601,45 +2828,38 @@ private:
 };
 
 struct format_handler_base {
+    // Number of arguments, for which the visited-flags are stored inline.
+    // Scanning more arguments than this will allocate.
+    static constexpr std::size_t inline_visited_args = 512;
+
     format_handler_base(size_t argcount) : args_count(argcount)
     {
-        if (SCN_UNLIKELY(args_count >= 64)) {
-            visited_args_upper.resize((args_count - 64) / 8);
+        if (SCN_UNLIKELY(args_count > inline_visited_args)) {
+            visited_args_dynamic.resize(visited_args_word_count());
+        }
+        else {
+            std::fill_n(visited_args_inline, visited_args_word_count(), 0);
         }
     }
 
     void check_args_exhausted()
     {
-        {
-            const auto args_count_lower64 = args_count >= 64 ? 64 : args_count;
-            const uint64_t mask = args_count_lower64 == 64
-                                      ? std::numeric_limits<uint64_t>::max()
-                                      : (1ull << args_count_lower64) - 1;
-
-            if (visited_args_lower64 != mask) {
+        const auto* words = visited_args_words();
+        const auto full_words = args_count / 64;
+        for (std::size_t i = 0; i < full_words; ++i) {
+            if (words[i] != std::numeric_limits<uint64_t>::max()) {
                 return on_error({scan_error::invalid_format_string,
                                  "Argument list not exhausted"});
             }
         }
 
-        if (args_count < 64) {
-            return;
-        }
-
-        auto last_args_count = args_count - 64;
-        for (auto it = visited_args_upper.begin();
-             it != visited_args_upper.end() - 1; ++it) {
-            if (*it != std::numeric_limits<uint8_t>::max()) {
+        if (const auto last_args_count = args_count % 64;
+            last_args_count != 0) {
+            const uint64_t mask = (1ull << last_args_count) - 1;
+            if (words[full_words] != mask) {
                 return on_error({scan_error::invalid_format_string,
                                  "Argument list not exhausted"});
             }
-            last_args_count -= 8;
-        }
-
-        const auto mask = static_cast<uint8_t>(1u << last_args_count) - 1;
-        if (visited_args_upper.back() != mask) {
-            return on_error({scan_error::invalid_format_string,
-                             "Argument list not exhausted"});
         }
     }
 
@@ -2667,12 +2887,7 @@ struct format_handler_base {
             return false;
         }
 
-        if (SCN_LIKELY(id < 64)) {
-            return (visited_args_lower64 >> id) & 1ull;
-        }
-
-        id -= 64;
-        return (visited_args_upper[id / 8] >> (id % 8)) & 1ull;
+        return (visited_args_words()[id / 64] >> (id % 64)) & 1ull;
     }
 
     void set_arg_as_visited(size_t id)
@@ -2688,19 +2903,28 @@ struct format_handler_base {
                       "Argument with this ID has already been scanned"});
         }
 
-        if (SCN_LIKELY(id < 64u)) {
-            visited_args_lower64 |= (1ull << id);
-            return;
-        }
-
-        id -= 64u;
-        visited_args_upper[id / 8u] |= static_cast<uint8_t>(1u << (id % 8u));
+        visited_args_words()[id / 64] |= (1ull << (id % 64));
     }
 
     std::size_t args_count;
     scan_expected<void> error{};
-    uint64_t visited_args_lower64{0};
-    std::vector<uint8_t> visited_args_upper{};
+
+private:
+    std::size_t visited_args_word_count() const
+    {
+        return (args_count + 63) / 64;
+    }
+
+    uint64_t* visited_args_words()
+    {
+        if (SCN_UNLIKELY(args_count > inline_visited_args)) {
+            return visited_args_dynamic.data();
+        }
+        return visited_args_inline;
+    }
+
+    uint64_t visited_args_inline[inline_visited_args / 64];
+    std::vector<uint64_t> visited_args_dynamic{};
 };
 
 template <typename CharT>
@@ -2795,7 +3019,40 @@ struct format_handler : format_handler_base {
 
     void on_literal_text(const char_type* begin, const char_type* end)
     {
+        bool try_bulk_match = true;
         for (; begin != end; ++begin) {
+            if constexpr (std::is_same_v<char_type, char>) {
+                // Match runs of non-whitespace ASCII with a single compare
+                if (try_bulk_match) {
+                    auto run_end = std::find_if(begin, end, [](char ch) {
+                        return !impl::is_ascii_char(ch) ||
+                               impl::is_ascii_space(ch);
+                    });
+                    if (run_end - begin > 1) {
+                        auto r = impl::read_matching_string_classic(
+                            get_ctx().range(),
+                            detail::make_string_view_from_pointers(begin,
+                                                                   run_end));
+                        if (SCN_LIKELY(r)) {
+                            get_ctx().advance_to(*r);
+                            // (-1 because of the for loop ++begin)
+                            begin = run_end - 1;
+                            continue;
+                        }
+                        if (r.error() == impl::parse_error::error) {
+                            SCN_UNLIKELY_ATTR
+                            return on_error(
+                                {scan_error::invalid_literal,
+                                 "Unexpected literal character in source"});
+                        }
+                        // Not enough input for the whole run:
+                        // go character-by-character to find out whether the
+                        // error is a mismatch or EOF
+                        try_bulk_match = false;
+                    }
+                }
+            }
+
             auto it = get_ctx().begin();
             if (impl::is_range_eof(it, get_ctx().end())) {
                 SCN_UNLIKELY_ATTR
@@ -2911,6 +3168,19 @@ struct format_handler : format_handler_base {
         return parse_ctx.begin();
     }
 
+    // Format specs already parsed, from a parsed_format
+    void on_parsed_format_specs(std::size_t arg_id,
+                                const detail::format_specs& specs)
+    {
+        auto arg = get_arg(get_ctx(), arg_id, *this);
+        set_arg_as_visited(arg_id);
+
+        on_visit_scan_arg(
+            impl::arg_reader<context_type>{get_ctx().range(), specs,
+                                           get_ctx().locale()},
+            arg);
+    }
+
     context_type& get_ctx()
     {
         return ctx.get();
@@ -2937,6 +3207,44 @@ scan_expected<std::ptrdiff_t> vscan_parse_format_string(
     return ranges::distance(beg, handler.get_ctx().begin());
 }
 
+template <typename CharT, typename ScanFn>
+scan_expected<std::ptrdiff_t> vscan_and_sync_buffer(
+    typename detail::basic_scan_buffer<
+        detail::type_identity_t<CharT>>::range_type source,
+    ScanFn&& scan_fn)
+{
+    SCN_EXPECT(source.begin().stores_parent());
+
+    auto& buffer = *source.begin().parent();
+    if (auto e = buffer.get_source_error(); SCN_UNLIKELY(!e)) {
+        return unexpected(e.error());
+    }
+
+    const auto begin_position = source.begin().position();
+    const auto end_position = scan_fn();
+
+    if (SCN_LIKELY(end_position)) {
+        if (SCN_UNLIKELY(!buffer.sync(*end_position))) {
+            return detail::unexpected_scan_error(
+                scan_error::invalid_source_state,
+                "Failed to sync with underlying source");
+        }
+    }
+    else {
+        if (SCN_UNLIKELY(!buffer.sync(begin_position))) {
+            return detail::unexpected_scan_error(
+                scan_error::invalid_source_state,
+                "Failed to sync with underlying source");
+        }
+    }
+
+    if (auto e = buffer.get_source_error(); SCN_UNLIKELY(!e)) {
+        return unexpected(e.error());
+    }
+
+    return end_position;
+}
+
 template <typename CharT>
 scan_expected<std::ptrdiff_t> vscan_internal(
     std::basic_string_view<CharT> source,
@@ -2949,6 +3257,10 @@ scan_expected<std::ptrdiff_t> vscan_internal(
         auto arg = args.get(0);
         return scan_simple_single_argument(source, SCN_MOVE(args), arg);
     }
+    if (is_simple_multiple_argument_format_string(format, argcount)) {
+        return scan_simple_multiple_arguments(source, format, SCN_MOVE(args),
+                                              loc);
+    }
 
     auto handler = format_handler<true, CharT>{
         ranges::subrange<const CharT*>{source.data(),
@@ -2970,44 +3282,21 @@ scan_expected<std::ptrdiff_t> vscan_internal(
                               loc);
     }
 
-    auto& buffer = *source.begin().parent();
-    if (auto e = buffer.get_source_error(); SCN_UNLIKELY(!e)) {
-        return unexpected(e.error());
-    }
-
-    const auto begin_position = source.begin().position();
-    const auto end_position = [&]() {
+    return vscan_and_sync_buffer<CharT>(source, [&]() {
         const auto argcount = args.size();
         if (is_simple_single_argument_format_string(format) && argcount == 1) {
             auto arg = args.get(0);
             return scan_simple_single_argument(source, SCN_MOVE(args), arg);
         }
+        if (is_simple_multiple_argument_format_string(format, argcount)) {
+            return scan_simple_multiple_arguments(source, format,
+                                                  SCN_MOVE(args), loc);
+        }
 
         auto handler = format_handler<false, CharT>{
             source, format, SCN_MOVE(args), loc, argcount};
         return vscan_parse_format_string(format, handler);
-    }();
-
-    if (SCN_LIKELY(end_position)) {
-        if (SCN_UNLIKELY(!buffer.sync(*end_position))) {
-            return detail::unexpected_scan_error(
-                scan_error::invalid_source_state,
-                "Failed to sync with underlying source");
-        }
-    }
-    else {
-        if (SCN_UNLIKELY(!buffer.sync(begin_position))) {
-            return detail::unexpected_scan_error(
-                scan_error::invalid_source_state,
-                "Failed to sync with underlying source");
-        }
-    }
-
-    if (auto e = buffer.get_source_error(); SCN_UNLIKELY(!e)) {
-        return unexpected(e.error());
-    }
-
-    return end_position;
+    });
 }
 
 template <typename Source, typename CharT>
@@ -3017,46 +3306,317 @@ scan_expected<std::ptrdiff_t> vscan_value_internal(
 {
     return scan_simple_single_argument(SCN_FWD(source), {}, arg);
 }
-}  // namespace
-
-namespace detail {
-template <typename T>
-auto scan_int_impl(std::string_view source, T& value, int base)
-    -> scan_expected<std::string_view::iterator>
-{
-    SCN_TRY(beg, impl::skip_classic_whitespace(source).transform_error(
-                     impl::make_eof_scan_error));
-    auto reader = impl::reader_impl_for_int<char>{};
-    return reader.read_default_with_base(ranges::subrange{beg, source.end()},
-                                         value, base);
-}
-
-template <typename T>
-auto scan_int_exhaustive_valid_impl(std::string_view source) -> T
-{
-    T value{};
-    impl::parse_integer_value_exhaustive_valid(source, value);
-    return value;
-}
 
-}  // namespace detail
+/////////////////////////////////////////////////////////////////
+// parsed_format implementation
+/////////////////////////////////////////////////////////////////
 
-SCN_PUBLIC vscan_result<stdin_tag_t> vinput(std::string_view format,
-                                            scan_args args)
-{
-    return detail::vscan_generic(stdin_tag, format, SCN_MOVE(args));
-}
+template <typename CharT>
+struct parsed_format_builder : format_handler_base {
+    using char_type = CharT;
+    using field_kind = detail::compiled_field_kind;
 
-template <typename Locale, typename>
-SCN_PUBLIC vscan_result<stdin_tag_t> vinput(const Locale& loc,
-                                            std::string_view format,
-                                            scan_args args)
-{
-    return detail::vscan_localized_generic(loc, stdin_tag, format,
-                                           SCN_MOVE(args));
-}
+    parsed_format_builder(
+        detail::parsed_format_data<CharT>& d,
+        const detail::parse_custom_specs_func<CharT>* custom_funcs)
+        : format_handler_base{d.arg_types.size()},
+          data(d),
+          custom_parse_funcs(custom_funcs),
+          parse_ctx{source_tag<std::basic_string_view<CharT>>, d.format}
+    {
+    }
 
-namespace detail {
+    void on_literal_text(const char_type* begin, const char_type* end)
+    {
+        while (begin != end) {
+            auto [after_space_it, cp, is_space] = impl::is_first_char_space(
+                detail::make_string_view_from_pointers(begin, end));
+            if (cp == detail::invalid_code_point) {
+                SCN_UNLIKELY_ATTR
+                return on_error({scan_error::invalid_format_string,
+                                 "Invalid encoding in format string"});
+            }
+
+            auto next = detail::to_address(after_space_it);
+            if (is_space) {
+                // Whitespace in the format string is collapsed,
+                // like when scanning with a runtime format string
+                next = detail::to_address(impl::read_while_classic_space(
+                    detail::make_string_view_from_pointers(next, end)));
+                push_field({field_kind::whitespace, 0, get_offset(begin),
+                            get_offset(next), false, {}});
+            }
+            else if (!data.fields.empty() &&
+                     data.fields.back().kind == field_kind::literal &&
+                     data.fields.back().end == get_offset(begin)) {
+                data.fields.back().end = get_offset(next);
+            }
+            else {
+                push_field({field_kind::literal, 0, get_offset(begin),
+                            get_offset(next), false, {}});
+            }
+            begin = next;
+        }
+    }
+
+    std::size_t on_arg_id()
+    {
+        return parse_ctx.next_arg_id();
+    }
+    std::size_t on_arg_id(std::size_t id)
+    {
+        parse_ctx.check_arg_id(id);
+        return id;
+    }
+
+    void on_replacement_field(std::size_t arg_id, const char_type* begin)
+    {
+        set_arg_as_visited(arg_id);
+        if (SCN_UNLIKELY(!get_error())) {
+            return;
+        }
+
+        push_field({get_field_kind(arg_id), arg_id, get_offset(begin),
+                    get_offset(begin), false, {}});
+    }
+
+    const char_type* on_format_specs(std::size_t arg_id,
+                                     const char_type* begin,
+                                     const char_type* end)
+    {
+        set_arg_as_visited(arg_id);
+        if (SCN_UNLIKELY(!get_error())) {
+            return begin;
+        }
+
+        auto field = detail::compiled_field{get_field_kind(arg_id),
+                                            arg_id,
+                                            get_offset(begin),
+                                            get_offset(begin),
+                                            true,
+                                            {}};
+        if (field.kind == field_kind::custom_field) {
+            parse_ctx.advance_to(begin);
+            auto it = custom_parse_funcs[arg_id](parse_ctx);
+            if (SCN_UNLIKELY(!it)) {
+                on_error(it.error());
+                return begin;
+            }
+            begin = *it;
+        }
+        else {
+            detail::specs_checker<detail::specs_setter> handler{
+                detail::specs_setter{field.specs}, data.arg_types[arg_id]};
+            begin = detail::parse_format_specs(begin, end, handler);
+            if (auto e = handler.get_error(); SCN_UNLIKELY(!e)) {
+                on_error(e.error());
+                return begin;
+            }
+        }
+
+        if (begin == end || *begin != char_type{'}'}) {
+            SCN_UNLIKELY_ATTR
+            on_error({scan_error::invalid_format_string,
+                      "Missing '}' in format string"});
+            return begin;
+        }
+        field.end = get_offset(begin);
+        push_field(field);
+        return begin;
+    }
+
+    std::size_t get_offset(const char_type* it) const
+    {
+        return static_cast<std::size_t>(it - data.format.data());
+    }
+
+    field_kind get_field_kind(std::size_t arg_id) const
+    {
+        return data.arg_types[arg_id] == detail::arg_type::custom_type
+                   ? field_kind::custom_field
+                   : field_kind::builtin_field;
+    }
+
+    void push_field(const detail::compiled_field& field)
+    {
+        data.fields.push_back(field);
+    }
+
+    detail::parsed_format_data<CharT>& data;
+    const detail::parse_custom_specs_func<CharT>* custom_parse_funcs;
+    basic_scan_parse_context<CharT> parse_ctx;
+};
+
+template <typename CharT>
+scan_expected<void> parse_format_internal(
+    detail::parsed_format_data<CharT>& data,
+    const detail::parse_custom_specs_func<CharT>* custom_parse_funcs)
+{
+    auto handler = parsed_format_builder<CharT>{data, custom_parse_funcs};
+    SCN_TRY_DISCARD(detail::parse_format_string<false>(
+        std::basic_string_view<CharT>{data.format}, handler));
+    return handler.parse_ctx.get_error();
+}
+
+template <typename CharT>
+scan_expected<void> check_parsed_format_args(
+    const detail::parsed_format_data<CharT>& format,
+    const basic_scan_args<detail::default_context<CharT>>& args)
+{
+    const auto argcount = format.arg_types.size();
+    if (SCN_UNLIKELY(static_cast<std::size_t>(args.size()) != argcount)) {
+        return detail::unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "Argument count doesn't match the parsed format string");
+    }
+    for (std::size_t i = 0; i < argcount; ++i) {
+        if (SCN_UNLIKELY(detail::get_arg_type(args.get(i)) !=
+                         format.arg_types[i])) {
+            return detail::unexpected_scan_error(
+                scan_error::invalid_format_string,
+                "Argument types don't match the parsed format string");
+        }
+    }
+    return {};
+}
+
+template <typename CharT, typename Handler>
+scan_expected<std::ptrdiff_t> vscan_parsed_fields(
+    const detail::parsed_format_data<CharT>& format,
+    Handler& handler)
+{
+    const auto beg = handler.get_ctx().begin();
+    const auto* const fmt = format.format.data();
+    const auto* const fmt_end = fmt + format.format.size();
+
+    for (const auto& field : format.fields) {
+        switch (field.kind) {
+            case detail::compiled_field_kind::literal:
+            case detail::compiled_field_kind::whitespace:
+                handler.on_literal_text(fmt + field.begin, fmt + field.end);
+                break;
+
+            case detail::compiled_field_kind::builtin_field:
+                if (field.has_specs) {
+                    handler.on_parsed_format_specs(field.arg_id, field.specs);
+                }
+                else {
+                    handler.on_replacement_field(field.arg_id,
+                                                 fmt + field.begin);
+                }
+                break;
+
+            case detail::compiled_field_kind::custom_field:
+                if (field.has_specs) {
+                    // The scanner of a custom type needs to parse its
+                    // format specs again, as its state can't be cached
+                    handler.on_format_specs(field.arg_id, fmt + field.begin,
+                                            fmt_end);
+                }
+                else {
+                    handler.on_replacement_field(field.arg_id,
+                                                 fmt + field.begin);
+                }
+                break;
+
+            // Only produced for format strings compiled with SCN_COMPILE
+            case detail::compiled_field_kind::regex_field:
+                SCN_CLANG_PUSH
+                SCN_CLANG_IGNORE("-Wcovered-switch-default")
+
+            default:
+                SCN_EXPECT(false);
+                SCN_UNREACHABLE;
+
+                SCN_CLANG_POP
+        }
+
+        if (auto err = handler.get_error(); SCN_UNLIKELY(!err)) {
+            return unexpected(err.error());
+        }
+    }
+    return ranges::distance(beg, handler.get_ctx().begin());
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_parsed_internal(
+    std::basic_string_view<CharT> source,
+    const detail::parsed_format_data<CharT>& format,
+    basic_scan_args<detail::default_context<CharT>> args,
+    detail::locale_ref loc = {})
+{
+    SCN_TRY_DISCARD(check_parsed_format_args(format, args));
+
+    auto handler = format_handler<true, CharT>{
+        ranges::subrange<const CharT*>{source.data(),
+                                       source.data() + source.size()},
+        std::basic_string_view<CharT>{format.format}, SCN_MOVE(args),
+        SCN_MOVE(loc), format.arg_types.size()};
+    return vscan_parsed_fields(format, handler);
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_parsed_internal(
+    typename detail::basic_scan_buffer<
+        detail::type_identity_t<CharT>>::range_type source,
+    const detail::parsed_format_data<CharT>& format,
+    basic_scan_args<detail::default_context<CharT>> args,
+    detail::locale_ref loc = {})
+{
+    if (!source.begin().stores_parent()) {
+        return vscan_parsed_internal(source.begin().contiguous_segment(),
+                                     format, args, loc);
+    }
+
+    SCN_TRY_DISCARD(check_parsed_format_args(format, args));
+
+    return vscan_and_sync_buffer<CharT>(source, [&]() {
+        auto handler = format_handler<false, CharT>{
+            source, std::basic_string_view<CharT>{format.format},
+            SCN_MOVE(args), loc, format.arg_types.size()};
+        return vscan_parsed_fields(format, handler);
+    });
+}
+}  // namespace
+
+namespace detail {
+template <typename T>
+auto scan_int_impl(std::string_view source, T& value, int base)
+    -> scan_expected<std::string_view::iterator>
+{
+    SCN_TRY(beg, impl::skip_classic_whitespace(source).transform_error(
+                     impl::make_eof_scan_error));
+    auto reader = impl::reader_impl_for_int<char>{};
+    return reader.read_default_with_base(ranges::subrange{beg, source.end()},
+                                         value, base);
+}
+
+template <typename T>
+auto scan_int_exhaustive_valid_impl(std::string_view source) -> T
+{
+    T value{};
+    impl::parse_integer_value_exhaustive_valid(source, value);
+    return value;
+}
+
+}  // namespace detail
+
+SCN_PUBLIC vscan_result<stdin_tag_t> vinput(std::string_view format,
+                                            scan_args args)
+{
+    return detail::vscan_generic(stdin_tag, format, SCN_MOVE(args));
+}
+
+template <typename Locale, typename>
+SCN_PUBLIC vscan_result<stdin_tag_t> vinput(const Locale& loc,
+                                            std::string_view format,
+                                            scan_args args)
+{
+    return detail::vscan_localized_generic(loc, stdin_tag, format,
+                                           SCN_MOVE(args));
+}
+
+namespace detail {
 
 SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_impl(std::string_view source,
                                                     std::string_view format,
@@ -3086,6 +3646,49 @@ SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_impl(
     return vscan_internal(source, format, args);
 }
 
+SCN_PUBLIC scan_expected<void> parse_format_impl(
+    parsed_format_data<char>& data,
+    const parse_custom_specs_func<char>* custom_parse_funcs)
+{
+    return parse_format_internal(data, custom_parse_funcs);
+}
+SCN_PUBLIC scan_expected<void> parse_format_impl(
+    parsed_format_data<wchar_t>& data,
+    const parse_custom_specs_func<wchar_t>* custom_parse_funcs)
+{
+    return parse_format_internal(data, custom_parse_funcs);
+}
+
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    std::string_view source,
+    const parsed_format_data<char>& format,
+    scan_args args)
+{
+    return vscan_parsed_internal(source, format, args);
+}
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    scan_buffer::range_type source,
+    const parsed_format_data<char>& format,
+    scan_args args)
+{
+    return vscan_parsed_internal(source, format, args);
+}
+
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    std::wstring_view source,
+    const parsed_format_data<wchar_t>& format,
+    wscan_args args)
+{
+    return vscan_parsed_internal(source, format, args);
+}
+SCN_PUBLIC scan_expected<std::ptrdiff_t> vscan_parsed_impl(
+    wscan_buffer::range_type source,
+    const parsed_format_data<wchar_t>& format,
+    wscan_args args)
+{
+    return vscan_parsed_internal(source, format, args);
+}
+
 #if !SCN_DISABLE_LOCALE
 template <typename Locale>
 scan_expected<std::ptrdiff_t> vscan_localized_impl(const Locale& loc,
@@ -3684,6 +4287,9 @@ struct datetime_setter<datetime_components> {
                             setter_state& st,
                             std::string n)
     {
+        if (auto resolver = get_tz_abbreviation_resolver()) {
+            t.tz_offset = resolver(n);
+        }
         t.tz_name = std::move(n);
         return st.set_tzname(h);
     }
@@ -3726,6 +4332,17 @@ struct datetime_setter<tm_with_tz> : datetime_setter<std::tm> {
                             setter_state& st,
                             std::string n)
     {
+        if (auto resolver = get_tz_abbreviation_resolver()) {
+            t.tz_offset = resolver(n);
+            if constexpr (mp_valid<has_tm_gmtoff_predicate, std::tm>::value) {
+                if (t.tz_offset) {
+                    assign_gmtoff(
+                        static_cast<std::tm&>(t),
+                        std::chrono::duration_cast<std::chrono::seconds>(
+                            *t.tz_offset));
+                }
+            }
+        }
         t.tz_name = std::move(n);
         return st.set_tzname(h);
     }
@@ -3912,6 +4529,165 @@ struct datetime_setter<year_month_day>
     }
 };
 
+// Classic (English) month and weekday names, matched case-insensitively in a
+// single probe: the three-letter abbreviation of every name is unique, and
+// a perfect hash of its second and third letter indexes `table`.
+// Every full name begins with its abbreviation.
+struct classic_time_names {
+    const std::string_view* names;
+    const signed char* table;
+    unsigned third_letter_weight;
+    unsigned mask;
+
+    // Index of the name abbreviated as `abbr` (in lowercase), or -1
+    constexpr int find(const char (&abbr)[3]) const
+    {
+        const auto h = (static_cast<unsigned>(abbr[1]) +
+                        third_letter_weight * static_cast<unsigned>(abbr[2])) &
+                       mask;
+        const int i = table[h];
+        if (i < 0 || names[i][0] != abbr[0] || names[i][1] != abbr[1] ||
+            names[i][2] != abbr[2]) {
+            return -1;
+        }
+        return i;
+    }
+};
+
+template <std::size_t TableSize, std::size_t N>
+constexpr std::array<signed char, TableSize> make_classic_time_name_table(
+    const std::string_view (&names)[N],
+    unsigned third_letter_weight)
+{
+    std::array<signed char, TableSize> table{};
+    for (auto& e : table) {
+        e = -1;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        const auto h = (static_cast<unsigned>(names[i][1]) +
+                        third_letter_weight *
+                            static_cast<unsigned>(names[i][2])) &
+                       (TableSize - 1);
+        // Not a perfect hash, if this fails
+        SCN_EXPECT(table[h] == -1);
+        table[h] = static_cast<signed char>(i);
+    }
+    return table;
+}
+
+inline constexpr std::string_view classic_month_name_list[] = {
+    "january", "february", "march",     "april",   "may",      "june",
+    "july",    "august",   "september", "october", "november", "december"};
+inline constexpr std::string_view classic_weekday_name_list[] = {
+    "sunday",   "monday", "tuesday", "wednesday",
+    "thursday", "friday", "saturday"};
+
+inline constexpr auto classic_month_name_table =
+    make_classic_time_name_table<32>(classic_month_name_list, 1);
+inline constexpr auto classic_weekday_name_table =
+    make_classic_time_name_table<16>(classic_weekday_name_list, 2);
+
+inline constexpr classic_time_names classic_month_names{
+    classic_month_name_list, classic_month_name_table.data(), 1, 31};
+inline constexpr classic_time_names classic_weekday_names{
+    classic_weekday_name_list, classic_weekday_name_table.data(), 2, 15};
+
+template <typename CharT>
+constexpr char classic_ascii_letter_to_lower(CharT ch)
+{
+    if (ch >= CharT{'A'} && ch <= CharT{'Z'}) {
+        return static_cast<char>(ch - CharT{'A'} + CharT{'a'});
+    }
+    if (ch >= CharT{'a'} && ch <= CharT{'z'}) {
+        return static_cast<char>(ch);
+    }
+    return 0;
+}
+
+#if !SCN_DISABLE_LOCALE
+// Month and weekday names of a locale, full and abbreviated, in lowercase,
+// generated once with std::time_put.
+// Used for %b/%B/%a/%A with the 'L' flag,
+// instead of calling into std::time_get for every field.
+template <typename CharT>
+struct localized_time_names {
+    using entry = std::pair<std::basic_string<CharT>, int>;
+
+    std::string locale_name;
+    // Sorted longest first, so that the first match is the longest one
+    std::vector<entry> months;
+    std::vector<entry> weekdays;
+};
+
+template <typename CharT>
+localized_time_names<CharT> make_localized_time_names(const std::locale& loc)
+{
+    const auto& put = std::use_facet<
+        std::time_put<CharT, std::ostreambuf_iterator<CharT>>>(loc);
+    const auto& ctype = std::use_facet<std::ctype<CharT>>(loc);
+
+    std::basic_ostringstream<CharT> stream{};
+    stream.imbue(loc);
+    auto format_name = [&](const std::tm& tm, char spec, char mod) {
+        stream.str({});
+        put.put(std::ostreambuf_iterator<CharT>{stream}, stream, CharT{' '},
+                &tm, spec, mod);
+        auto name = stream.str();
+        ctype.tolower(name.data(), name.data() + name.size());
+        return name;
+    };
+
+    // The alternative ('O') forms are the nominative month names,
+    // in locales where the default ones are in the genitive case
+    localized_time_names<CharT> names{loc.name(), {}, {}};
+    std::tm tm{};
+    for (int m = 0; m < 12; ++m) {
+        tm.tm_mon = m;
+        for (char spec : {'B', 'b'}) {
+            for (char mod : {'\0', 'O'}) {
+                if (auto name = format_name(tm, spec, mod); !name.empty()) {
+                    names.months.emplace_back(SCN_MOVE(name), m + 1);
+                }
+            }
+        }
+    }
+    for (int d = 0; d < 7; ++d) {
+        tm.tm_wday = d;
+        for (char spec : {'A', 'a'}) {
+            if (auto name = format_name(tm, spec, '\0'); !name.empty()) {
+                names.weekdays.emplace_back(SCN_MOVE(name), d);
+            }
+        }
+    }
+
+    auto longest_first = [](const auto& a, const auto& b) {
+        return a.first.size() > b.first.size();
+    };
+    std::stable_sort(names.months.begin(), names.months.end(), longest_first);
+    std::stable_sort(names.weekdays.begin(), names.weekdays.end(),
+                     longest_first);
+    return names;
+}
+
+// Returns the names of `loc`, cached per thread,
+// or nullptr if `loc` has no name to tell it apart from other locales.
+template <typename CharT>
+const localized_time_names<CharT>* get_localized_time_names(
+    const std::locale& loc)
+{
+    thread_local std::optional<localized_time_names<CharT>> cache{};
+
+    const auto name = loc.name();
+    if (name == "*") {
+        return nullptr;
+    }
+    if (!cache || cache->locale_name != name) {
+        cache = make_localized_time_names<CharT>(loc);
+    }
+    return &*cache;
+}
+#endif  // !SCN_DISABLE_LOCALE
+
 template <typename T, typename Range, typename CharT>
 class tm_reader {
 public:
@@ -4022,8 +4798,12 @@ public:
 
     void on_month_name()
     {
-#if !SCN_DISABLE_FAST_FLOAT
+#if !SCN_DISABLE_LOCALE
         if (m_st.localized) {
+            if (auto m = read_localized_name(
+                    &localized_time_names<CharT>::months)) {
+                return setter::set_mon(*this, m_tm, m_st, *m);
+            }
             if (auto t = read_localized("%b", L"%b")) {
                 setter::set_mon(*this, m_tm, m_st, t->tm_mon + 1);
             }
@@ -4031,38 +4811,8 @@ public:
         }
 #endif
 
-        std::array<std::pair<std::string_view, int>, 12> long_mapping = {{
-            {"January", 1},
-            {"February", 2},
-            {"March", 3},
-            {"April", 4},
-            {"May", 5},
-            {"June", 6},
-            {"July", 7},
-            {"August", 8},
-            {"September", 9},
-            {"October", 10},
-            {"November", 11},
-            {"December", 12},
-        }};
-        if (auto m = try_one_of_str_nocase(long_mapping)) {
-            return setter::set_mon(*this, m_tm, m_st, *m);
-        }
-        std::array<std::pair<std::string_view, int>, 11> short_mapping = {{
-            {"Jan", 1},
-            {"Feb", 2},
-            {"Mar", 3},
-            {"Apr", 4},
-            {"Jun", 6},
-            {"Jul", 7},
-            {"Aug", 8},
-            {"Sep", 9},
-            {"Oct", 10},
-            {"Nov", 11},
-            {"Dec", 12},
-        }};
-        if (auto m = try_one_of_str_nocase(short_mapping)) {
-            return setter::set_mon(*this, m_tm, m_st, *m);
+        if (auto m = read_classic_name(classic_month_names)) {
+            return setter::set_mon(*this, m_tm, m_st, *m + 1);
         }
         set_error({scan_error::invalid_scanned_value, "Invalid month name"});
     }
@@ -4121,6 +4871,10 @@ public:
     {
 #if !SCN_DISABLE_LOCALE
         if (m_st.localized) {
+            if (auto d = read_localized_name(
+                    &localized_time_names<CharT>::weekdays)) {
+                return setter::set_wday(*this, m_tm, m_st, *d);
+            }
             if (auto t = read_localized("%a", L"%a")) {
                 setter::set_wday(*this, m_tm, m_st, t->tm_wday);
             }
@@ -4128,28 +4882,7 @@ public:
         }
 #endif
 
-        std::array<std::pair<std::string_view, int>, 7> long_mapping = {{
-            {"Sunday", 0},
-            {"Monday", 1},
-            {"Tuesday", 2},
-            {"Wednesday", 3},
-            {"Thursday", 4},
-            {"Friday", 5},
-            {"Saturday", 6},
-        }};
-        if (auto d = try_one_of_str_nocase(long_mapping)) {
-            return setter::set_wday(*this, m_tm, m_st, *d);
-        }
-        std::array<std::pair<std::string_view, int>, 7> short_mapping = {{
-            {"Sun", 0},
-            {"Mon", 1},
-            {"Tue", 2},
-            {"Wed", 3},
-            {"Thu", 4},
-            {"Fri", 5},
-            {"Sat", 6},
-        }};
-        if (auto d = try_one_of_str_nocase(short_mapping)) {
+        if (auto d = read_classic_name(classic_weekday_names)) {
             return setter::set_wday(*this, m_tm, m_st, *d);
         }
         return set_error(
@@ -4381,22 +5114,24 @@ public:
     }
     void on_tz_name()
     {
-        auto res = scan<std::string>(
-            ranges::subrange{m_begin, m_range.end()}, []() -> decltype(auto) {
-                if constexpr (std::is_same_v<CharT, char>) {
-                    return "{:[a-zA-Z0-9-+_/]}";
-                }
-                else {
-                    return L"{:[a-zA-Z0-9-+_/]}";
-                }
-            }());
-        if (!res) {
-            set_error(res.error());
+        // Read directly, instead of with a nested scan<std::string>:
+        // names are short, and fit in the small string buffer
+        std::string name{};
+        for (; m_begin != m_range.end(); ++m_begin) {
+            const auto ch = *m_begin;
+            if (!((ch >= CharT{'a'} && ch <= CharT{'z'}) ||
+                  (ch >= CharT{'A'} && ch <= CharT{'Z'}) ||
+                  (ch >= CharT{'0'} && ch <= CharT{'9'}) || ch == CharT{'-'} ||
+                  ch == CharT{'+'} || ch == CharT{'_'} || ch == CharT{'/'})) {
+                break;
+            }
+            name.push_back(static_cast<char>(ch));
         }
-        else {
-            setter::set_tz_name(*this, m_tm, m_st, std::move(res->value()));
+        if (name.empty()) {
+            return set_error(
+                {scan_error::invalid_scanned_value, "Invalid timezone name"});
         }
-        m_begin = res->begin();
+        setter::set_tz_name(*this, m_tm, m_st, SCN_MOVE(name));
     }
 
     void on_loc_datetime(numeric_system sys = numeric_system::standard)
@@ -4582,6 +5317,64 @@ public:
         unimplemented();
     }
 
+    // Fast path for formats with a fixed layout, like ISO 8601 / RFC 3339
+    // (`%Y-%m-%dT%H:%M:%.S%z`), `%F %T`, or CLF (`%d/%b/%Y:%H:%M:%S %z`),
+    // when reading from a contiguous source.
+    // Every numeric field is read with its full number of digits, without
+    // going through the generic per-specifier dispatch.
+    // If the format or the input doesn't fit, nothing is consumed, and
+    // `false` is returned, to fall back to the generic path.
+    bool read_fixed_layout(std::basic_string_view<CharT> fmt)
+    {
+        if constexpr (!std::is_pointer_v<iterator>) {
+            SCN_UNUSED(fmt);
+            return false;
+        }
+        else {
+            if (fmt.empty() || fmt.front() != CharT{'%'}) {
+                return false;
+            }
+
+            fixed_layout_values values{};
+            auto p = m_begin;
+            const auto end = ranges::end(m_range);
+            auto f = fmt.begin();
+            while (f != fmt.end()) {
+                const auto ch = *f++;
+                if (ch != CharT{'%'}) {
+                    if (!read_fixed_layout_literal(ch, p, end)) {
+                        return false;
+                    }
+                    continue;
+                }
+                if (f == fmt.end()) {
+                    return false;
+                }
+                if (*f == CharT{'.'}) {
+                    // %.S
+                    if (fmt.end() - f < 2 || f[1] != CharT{'S'} ||
+                        values.full() ||
+                        !read_fixed_layout_subsecond(p, end, values)) {
+                        return false;
+                    }
+                    f += 2;
+                    continue;
+                }
+                if (!read_fixed_layout_field(*f++, p, end, values)) {
+                    return false;
+                }
+            }
+
+            for (std::size_t i = 0; i < values.count; ++i) {
+                set_fixed_layout_value(values.fields[i], values.values[i],
+                                       values.subsec);
+            }
+            m_begin = p;
+            verify();
+            return true;
+        }
+    }
+
     void verify()
     {
         m_st.verify(*this);
@@ -4621,6 +5414,296 @@ private:
         on_error("Unimplemented");
     }
 
+    enum class fixed_layout_field : unsigned char {
+        full_year,
+        mon,
+        mday,
+        hour24,
+        min,
+        sec,
+        subsec,
+        tz_offset,
+    };
+
+    // Values read by read_fixed_layout, set only after the whole format
+    // has been matched, in format order
+    struct fixed_layout_values {
+        void push(fixed_layout_field field, int value)
+        {
+            SCN_EXPECT(count < fields.size());
+            fields[count] = field;
+            values[count] = value;
+            ++count;
+        }
+
+        bool full() const
+        {
+            // Room for the two values of %.S
+            return count + 2 > fields.size();
+        }
+
+        std::array<fixed_layout_field, 16> fields{};
+        std::array<int, 16> values{};
+        std::size_t count{0};
+        double subsec{0.0};
+    };
+
+    static bool is_fixed_layout_digit(CharT ch)
+    {
+        return ch >= CharT{'0'} && ch <= CharT{'9'};
+    }
+
+    // Reads exactly `N` digits
+    template <std::size_t N>
+    static bool read_fixed_layout_digits(const CharT*& p,
+                                         const CharT* end,
+                                         int& value)
+    {
+        if (end - p < static_cast<std::ptrdiff_t>(N)) {
+            return false;
+        }
+        int result = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!is_fixed_layout_digit(p[i])) {
+                return false;
+            }
+            result = result * 10 + static_cast<int>(p[i] - CharT{'0'});
+        }
+        p += N;
+        value = result;
+        return true;
+    }
+
+    static bool read_fixed_layout_literal(CharT ch,
+                                          const CharT*& p,
+                                          const CharT* end)
+    {
+        if (ch == 0x20 || (ch >= 0x09 && ch <= 0x0d)) {
+            while (p != end && (*p == 0x20 || (*p >= 0x09 && *p <= 0x0d))) {
+                ++p;
+            }
+            // Non-ASCII whitespace is skipped by the generic path
+            return p == end || static_cast<std::make_unsigned_t<CharT>>(*p) <
+                                   0x80;
+        }
+        if (static_cast<std::make_unsigned_t<CharT>>(ch) >= 0x80 ||
+            p == end || *p != ch) {
+            return false;
+        }
+        ++p;
+        return true;
+    }
+
+    static bool read_fixed_layout_field(CharT spec,
+                                        const CharT*& p,
+                                        const CharT* end,
+                                        fixed_layout_values& values)
+    {
+        if (values.full()) {
+            return false;
+        }
+
+        auto read_two_digits = [&](fixed_layout_field field) {
+            int value{};
+            if (!read_fixed_layout_digits<2>(p, end, value)) {
+                return false;
+            }
+            values.push(field, value);
+            return true;
+        };
+        auto read_literal = [&](char ch) {
+            return read_fixed_layout_literal(static_cast<CharT>(ch), p, end);
+        };
+
+        switch (static_cast<char>(spec)) {
+            case '%':
+                return read_literal('%');
+
+            case 'Y': {
+                int value{};
+                if (!read_fixed_layout_digits<4>(p, end, value)) {
+                    return false;
+                }
+                values.push(fixed_layout_field::full_year, value);
+                return true;
+            }
+            case 'm':
+                return read_two_digits(fixed_layout_field::mon);
+            case 'd':
+            case 'e':
+                return read_two_digits(fixed_layout_field::mday);
+            case 'H':
+            case 'k':
+                return read_two_digits(fixed_layout_field::hour24);
+            case 'M':
+                return read_two_digits(fixed_layout_field::min);
+            case 'S':
+                return read_two_digits(fixed_layout_field::sec);
+
+            case 'F':
+                // %Y-%m-%d
+                return read_fixed_layout_field(CharT{'Y'}, p, end, values) &&
+                       read_literal('-') &&
+                       read_fixed_layout_field(CharT{'m'}, p, end, values) &&
+                       read_literal('-') &&
+                       read_fixed_layout_field(CharT{'d'}, p, end, values);
+            case 'T':
+                // %H:%M:%S
+                return read_fixed_layout_field(CharT{'H'}, p, end, values) &&
+                       read_literal(':') &&
+                       read_fixed_layout_field(CharT{'M'}, p, end, values) &&
+                       read_literal(':') &&
+                       read_fixed_layout_field(CharT{'S'}, p, end, values);
+
+            case 'b':
+            case 'B':
+            case 'h':
+                return read_fixed_layout_month_name(p, end, values);
+
+            case 'z':
+                return read_fixed_layout_tz_offset(p, end, values);
+
+            default:
+                return false;
+        }
+    }
+
+    // Abbreviated English month names, as three letters
+    static bool read_fixed_layout_month_name(const CharT*& p,
+                                             const CharT* end,
+                                             fixed_layout_values& values)
+    {
+        if (end - p < 3) {
+            return false;
+        }
+        char lower[3]{};
+        for (int i = 0; i < 3; ++i) {
+            lower[i] = classic_ascii_letter_to_lower(p[i]);
+            if (lower[i] == 0) {
+                return false;
+            }
+        }
+        // A longer name is left for the generic path
+        if (end - p > 3 && classic_ascii_letter_to_lower(p[3]) != 0) {
+            return false;
+        }
+
+        const int i = classic_month_names.find(lower);
+        if (i < 0) {
+            return false;
+        }
+        p += 3;
+        values.push(fixed_layout_field::mon, i + 1);
+        return true;
+    }
+
+    // [+|-]hh[[:]mm]
+    static bool read_fixed_layout_tz_offset(const CharT*& p,
+                                            const CharT* end,
+                                            fixed_layout_values& values)
+    {
+        if (p == end) {
+            return false;
+        }
+        bool is_minus = false;
+        if (*p == CharT{'+'} || *p == CharT{'-'}) {
+            is_minus = *p == CharT{'-'};
+            ++p;
+        }
+
+        int hour{};
+        int minute = 0;
+        if (!read_fixed_layout_digits<2>(p, end, hour)) {
+            return false;
+        }
+        if (p != end && *p == CharT{':'}) {
+            if (end - p >= 2 && is_fixed_layout_digit(p[1])) {
+                ++p;
+                if (!read_fixed_layout_digits<2>(p, end, minute)) {
+                    return false;
+                }
+            }
+        }
+        else if (p != end && is_fixed_layout_digit(*p)) {
+            if (!read_fixed_layout_digits<2>(p, end, minute)) {
+                return false;
+            }
+        }
+
+        values.push(fixed_layout_field::tz_offset,
+                    (is_minus ? -1 : 1) * (hour * 60 + minute));
+        return true;
+    }
+
+    // SS.fff, with at most 15 fractional digits, so that the
+    // fraction is exactly representable before the division
+    static bool read_fixed_layout_subsecond(const CharT*& p,
+                                            const CharT* end,
+                                            fixed_layout_values& values)
+    {
+        int whole{};
+        if (!read_fixed_layout_digits<2>(p, end, whole)) {
+            return false;
+        }
+        if (p == end || *p != CharT{'.'}) {
+            return false;
+        }
+        ++p;
+
+        std::uint64_t fraction = 0;
+        double divisor = 1.0;
+        int digits = 0;
+        for (; p != end && is_fixed_layout_digit(*p); ++p, ++digits) {
+            if (digits == 15) {
+                return false;
+            }
+            fraction = fraction * 10 + static_cast<std::uint64_t>(*p - '0');
+            divisor *= 10.0;
+        }
+        if (digits == 0) {
+            return false;
+        }
+
+        values.push(fixed_layout_field::sec, whole);
+        values.push(fixed_layout_field::subsec, 0);
+        values.subsec = static_cast<double>(fraction) / divisor;
+        return true;
+    }
+
+    void set_fixed_layout_value(fixed_layout_field field,
+                                int value,
+                                double subsec)
+    {
+        switch (field) {
+            case fixed_layout_field::full_year:
+                return setter::set_full_year(*this, m_tm, m_st, value);
+            case fixed_layout_field::mon:
+                return setter::set_mon(*this, m_tm, m_st, value);
+            case fixed_layout_field::mday:
+                return setter::set_mday(*this, m_tm, m_st, value);
+            case fixed_layout_field::hour24:
+                return setter::set_hour24(*this, m_tm, m_st, value);
+            case fixed_layout_field::min:
+                return setter::set_min(*this, m_tm, m_st, value);
+            case fixed_layout_field::sec:
+                return setter::set_sec(*this, m_tm, m_st, value);
+            case fixed_layout_field::subsec:
+                return setter::set_subsec(*this, m_tm, m_st, subsec);
+            case fixed_layout_field::tz_offset:
+                return setter::set_tz_offset(*this, m_tm, m_st,
+                                             std::chrono::minutes{value});
+
+                SCN_CLANG_PUSH
+                SCN_CLANG_IGNORE("-Wcovered-switch-default")
+
+            default:
+                SCN_EXPECT(false);
+                SCN_UNREACHABLE;
+
+                SCN_CLANG_POP
+        }
+    }
+
     int read_classic_unsigned_integer(int min_digits, int max_digits)
     {
         int digits_read = 0;
@@ -4645,6 +5728,40 @@ private:
         return accumulator;
     }
 
+    // Reads a full or an abbreviated name from `names`, case-insensitively,
+    // preferring the full name. Returns the index of the name.
+    std::optional<int> read_classic_name(const classic_time_names& names)
+    {
+        auto it = m_begin;
+        char abbr[3]{};
+        for (auto& ch : abbr) {
+            if (it == m_range.end()) {
+                return std::nullopt;
+            }
+            ch = classic_ascii_letter_to_lower(*it);
+            if (ch == 0) {
+                return std::nullopt;
+            }
+            ++it;
+        }
+
+        const int i = names.find(abbr);
+        if (i < 0) {
+            return std::nullopt;
+        }
+        m_begin = it;
+
+        const auto full = names.names[i];
+        for (std::size_t n = 3; n < full.size(); ++n, ++it) {
+            if (it == m_range.end() ||
+                classic_ascii_letter_to_lower(*it) != full[n]) {
+                return i;
+            }
+        }
+        m_begin = it;
+        return i;
+    }
+
     bool consume_ch(char ch)
     {
         if (m_begin == m_range.end()) {
@@ -4757,6 +5874,38 @@ private:
         return *m_loc_state;
     }
 
+    // Reads a name from the cached names of the locale, if it has any.
+    // Returns std::nullopt without an error if no name matches,
+    // to fall back on std::time_get.
+    std::optional<int> read_localized_name(
+        std::vector<typename localized_time_names<CharT>::entry>
+            localized_time_names<CharT>::*list)
+    {
+        // Not the locale of get_localized_read_state(),
+        // which may have had facets added to it, and lost its name
+        const auto loc = m_loc.get<std::locale>();
+        const auto* names = get_localized_time_names<CharT>(loc);
+        if (!names) {
+            return std::nullopt;
+        }
+
+        const auto& ctype = std::use_facet<std::ctype<CharT>>(loc);
+        for (const auto& [name, value] : names->*list) {
+            auto it = m_begin;
+            auto name_it = name.begin();
+            for (; name_it != name.end(); ++name_it, ++it) {
+                if (it == m_range.end() || ctype.tolower(*it) != *name_it) {
+                    break;
+                }
+            }
+            if (name_it == name.end()) {
+                m_begin = it;
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
     std::optional<std::tm> do_read_localized(std::basic_string_view<CharT> fmt)
     {
         const auto& facet = *get_localized_read_state().time_facet;
@@ -4827,7 +5976,10 @@ auto chrono_scan_inner_impl(std::basic_string_view<CharT> fmt,
 
     auto r = detail::tm_reader<T, typename Context::range_type, CharT>(
         ctx.range(), t, ctx.locale());
-    detail::parse_chrono_format_specs(fmt.data(), fmt.data() + fmt.size(), r);
+    if (!r.read_fixed_layout(fmt)) {
+        detail::parse_chrono_format_specs(fmt.data(), fmt.data() + fmt.size(),
+                                          r);
+    }
     if (auto e = r.get_error(); SCN_UNLIKELY(!e)) {
         return unexpected(e.error());
     }
@@ -4853,6 +6005,38 @@ auto chrono_scan_impl(std::basic_string_view<CharT> fmt_str, T& t, Context& ctx)
     return ctx.begin().batch_advance(std::distance(begin, it));
 }
 
+template <typename CharT>
+auto chrono_scan_batch_line_impl(std::basic_string_view<CharT> line,
+                                 std::basic_string_view<CharT> fmt,
+                                 datetime_components& dt)
+    -> scan_expected<void>
+{
+    using range_type = ranges::subrange<const CharT*>;
+    const auto source = range_type{line.data(), line.data() + line.size()};
+    SCN_TRY(it, detail::internal_skip_classic_whitespace(source, false));
+
+    auto r = detail::tm_reader<datetime_components, range_type, CharT>(
+        range_type{it, source.end()}, dt, {});
+    if (!r.read_fixed_layout(fmt)) {
+        detail::parse_chrono_format_specs(fmt.data(), fmt.data() + fmt.size(),
+                                          r);
+    }
+    return r.get_error();
+}
+
+auto chrono_scan_batch_line(std::string_view line,
+                            std::string_view fmt,
+                            datetime_components& dt) -> scan_expected<void>
+{
+    return chrono_scan_batch_line_impl(line, fmt, dt);
+}
+auto chrono_scan_batch_line(std::wstring_view line,
+                            std::wstring_view fmt,
+                            datetime_components& dt) -> scan_expected<void>
+{
+    return chrono_scan_batch_line_impl(line, fmt, dt);
+}
+
 template auto chrono_scan_impl(std::string_view, std::tm&, scan_context&)
     -> scan_expected<scan_context::iterator>;
 template auto chrono_scan_impl(std::string_view, tm_with_tz&, scan_context&)
@@ -4873,6 +6057,72 @@ template auto chrono_scan_impl(std::wstring_view,
 
 }  // namespace detail
 
+namespace {
+
+struct tz_abbreviation_entry {
+    std::string_view name;
+    short offset_minutes;
+};
+
+// Sorted by name, for binary search
+constexpr tz_abbreviation_entry common_tz_abbreviations[] = {
+    {"ACDT", 10 * 60 + 30}, {"ACST", 9 * 60 + 30}, {"ADT", -3 * 60},
+    {"AEDT", 11 * 60},      {"AEST", 10 * 60},     {"AKDT", -8 * 60},
+    {"AKST", -9 * 60},      {"AWST", 8 * 60},      {"CDT", -5 * 60},
+    {"CEST", 2 * 60},       {"CET", 1 * 60},       {"CST", -6 * 60},
+    {"EDT", -4 * 60},       {"EEST", 3 * 60},      {"EET", 2 * 60},
+    {"EST", -5 * 60},       {"GMT", 0},            {"HKT", 8 * 60},
+    {"HST", -10 * 60},      {"JST", 9 * 60},       {"KST", 9 * 60},
+    {"MDT", -6 * 60},       {"MEST", 2 * 60},      {"MET", 1 * 60},
+    {"MSK", 3 * 60},        {"MST", -7 * 60},      {"NDT", -2 * 60 - 30},
+    {"NST", -3 * 60 - 30},  {"NZDT", 13 * 60},     {"NZST", 12 * 60},
+    {"PDT", -7 * 60},       {"PST", -8 * 60},      {"SGT", 8 * 60},
+    {"UT", 0},              {"UTC", 0},            {"WEST", 1 * 60},
+    {"WET", 0},             {"Z", 0},
+};
+
+constexpr bool is_tz_abbreviation_table_sorted()
+{
+    for (std::size_t i = 1; i < std::size(common_tz_abbreviations); ++i) {
+        if (!(common_tz_abbreviations[i - 1].name <
+              common_tz_abbreviations[i].name)) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(is_tz_abbreviation_table_sorted());
+
+std::atomic<tz_abbreviation_resolver> current_tz_abbreviation_resolver{
+    &resolve_common_tz_abbreviation};
+
+}  // namespace
+
+std::optional<std::chrono::minutes> resolve_common_tz_abbreviation(
+    std::string_view name)
+{
+    const auto it = std::lower_bound(
+        std::begin(common_tz_abbreviations), std::end(common_tz_abbreviations),
+        name, [](const tz_abbreviation_entry& e, std::string_view n) {
+            return e.name < n;
+        });
+    if (it == std::end(common_tz_abbreviations) || it->name != name) {
+        return std::nullopt;
+    }
+    return std::chrono::minutes{it->offset_minutes};
+}
+
+tz_abbreviation_resolver set_tz_abbreviation_resolver(
+    tz_abbreviation_resolver resolver)
+{
+    return current_tz_abbreviation_resolver.exchange(resolver);
+}
+
+tz_abbreviation_resolver get_tz_abbreviation_resolver()
+{
+    return current_tz_abbreviation_resolver.load(std::memory_order_relaxed);
+}
+
 #endif  // !SCN_DISABLE_CHRONO
 
 #if !SCN_DISABLE_IOSTREAM
@@ -21,9 +21,13 @@
 #include <scn/regex.h>
 #include <scn/xchar.h>
 
+#include <scn/impl_width_table.h>
+
 #include <algorithm>
+#include <array>
 #include <clocale>
 #include <cmath>
+#include <cstring>
 #include <cwchar>
 #include <functional>
 #include <memory>
@@ -1667,7 +1671,7 @@ struct iterator_value_result {
 namespace impl {
 
 template <typename CharT>
-constexpr bool validate_unicode(std::basic_string_view<CharT> src)
+constexpr bool validate_unicode_scalar(std::basic_string_view<CharT> src)
 {
     auto it = src.begin();
     while (it != src.end()) {
@@ -1690,6 +1694,54 @@ constexpr bool validate_unicode(std::basic_string_view<CharT> src)
     return true;
 }
 
+// Same result as validate_unicode_scalar, but skips over runs of ASCII
+// eight bytes at a time, decoding code points only around non-ASCII bytes.
+inline bool validate_utf8_fast(std::string_view src)
+{
+    auto it = src.data();
+    const auto end = src.data() + src.size();
+
+    while (it != end) {
+        if (end - it >= 8) {
+            uint64_t word{};
+            std::memcpy(&word, it, 8);
+            if (has_byte_greater(word, 127) == 0) {
+                it += 8;
+                continue;
+            }
+        }
+
+        if (static_cast<unsigned char>(*it) < 0x80) {
+            ++it;
+            continue;
+        }
+
+        const auto len = static_cast<std::ptrdiff_t>(
+            detail::code_point_length_by_starting_code_unit(*it));
+        if (len == 0 || end - it < len) {
+            return false;
+        }
+        const auto cp = detail::decode_code_point_exhaustive(
+            std::string_view{it, static_cast<std::size_t>(len)});
+        if (cp >= detail::invalid_code_point) {
+            return false;
+        }
+        it += len;
+    }
+    return true;
+}
+
+template <typename CharT>
+constexpr bool validate_unicode(std::basic_string_view<CharT> src)
+{
+    if constexpr (std::is_same_v<CharT, char>) {
+        if (!detail::is_constant_evaluated()) {
+            return validate_utf8_fast(src);
+        }
+    }
+    return validate_unicode_scalar(src);
+}
+
 template <typename Range>
 constexpr auto get_start_for_next_code_point(Range input)
     -> ranges::const_iterator_t<Range>
@@ -1780,6 +1832,71 @@ inline constexpr scan_expected<wchar_t> encode_code_point_as_wide_character(
     }
 }
 
+template <bool VerifiedValid, typename SourceCharT, typename DestCharT>
+void transcode_to_string_impl_8to16or32(
+    std::basic_string_view<SourceCharT> src,
+    std::basic_string<DestCharT>& dest)
+{
+    static_assert(sizeof(SourceCharT) == 1);
+    static_assert(sizeof(DestCharT) == 2 || sizeof(DestCharT) == 4);
+
+    // Every UTF-8 code unit produces at most one UTF-16 or UTF-32 code unit:
+    // size the output once, and shrink it at the end.
+    const auto initial_size = dest.size();
+    dest.resize(initial_size + src.size());
+    auto out = dest.data() + initial_size;
+
+    auto it = src.data();
+    const auto end = src.data() + src.size();
+    while (it != end) {
+        if (end - it >= 8) {
+            uint64_t word{};
+            std::memcpy(&word, it, 8);
+            if (has_byte_greater(word, 127) == 0) {
+                for (std::size_t i = 0; i < 8; ++i) {
+                    out[i] = static_cast<DestCharT>(
+                        static_cast<unsigned char>(it[i]));
+                }
+                it += 8;
+                out += 8;
+                continue;
+            }
+        }
+
+        if (static_cast<unsigned char>(*it) < 0x80) {
+            *out++ = static_cast<DestCharT>(static_cast<unsigned char>(*it));
+            ++it;
+            continue;
+        }
+
+        const auto input = std::basic_string_view<SourceCharT>{
+            it, static_cast<std::size_t>(end - it)};
+        auto res = VerifiedValid ? get_next_code_point_valid(input)
+                                 : get_next_code_point(input);
+        it += ranges::distance(input.begin(), res.iterator);
+
+        auto cp = res.value;
+        if constexpr (VerifiedValid) {
+            SCN_EXPECT(cp < detail::invalid_code_point);
+        }
+        else if (SCN_UNLIKELY(cp == detail::invalid_code_point)) {
+            cp = 0xfffd;
+        }
+
+        if constexpr (sizeof(DestCharT) == 2) {
+            if (cp >= 0x10000) {
+                const auto u32cp = static_cast<uint32_t>(cp) - 0x10000;
+                *out++ = static_cast<DestCharT>(u32cp / 0x400 + 0xd800);
+                *out++ = static_cast<DestCharT>(u32cp % 0x400 + 0xdc00);
+                continue;
+            }
+        }
+        *out++ = static_cast<DestCharT>(cp);
+    }
+
+    dest.resize(static_cast<std::size_t>(out - dest.data()));
+}
+
 template <typename SourceCharT, typename DestCharT>
 void transcode_to_string_impl_to32(std::basic_string_view<SourceCharT> src,
                                    std::basic_string<DestCharT>& dest)
@@ -1825,43 +1942,62 @@ void transcode_to_string_impl_32to8(std::basic_string_view<SourceCharT> src,
     static_assert(sizeof(SourceCharT) == 4);
     static_assert(sizeof(DestCharT) == 1);
 
-    for (auto cp : src) {
+    // A code point is at most four UTF-8 code units:
+    // size the output once, and shrink it at the end.
+    const auto initial_size = dest.size();
+    dest.resize(initial_size + src.size() * 4);
+    auto out = dest.data() + initial_size;
+
+    for (auto it = src.begin(); it != src.end(); ++it) {
+        if (src.end() - it >= 4 &&
+            static_cast<uint32_t>(it[0] | it[1] | it[2] | it[3]) < 128) {
+            out[0] = static_cast<DestCharT>(it[0]);
+            out[1] = static_cast<DestCharT>(it[1]);
+            out[2] = static_cast<DestCharT>(it[2]);
+            out[3] = static_cast<DestCharT>(it[3]);
+            out += 4;
+            it += 3;
+            continue;
+        }
+
+        const auto cp = *it;
         const auto u32cp = static_cast<uint32_t>(cp);
         if (SCN_UNLIKELY(!VerifiedValid && static_cast<char32_t>(cp) >=
                                                detail::invalid_code_point)) {
             // Replacement character
-            dest.push_back(static_cast<char>(0xef));
-            dest.push_back(static_cast<char>(0xbf));
-            dest.push_back(static_cast<char>(0xbd));
+            *out++ = static_cast<char>(0xef);
+            *out++ = static_cast<char>(0xbf);
+            *out++ = static_cast<char>(0xbd);
         }
         else if (cp < 128) {
-            dest.push_back(static_cast<char>(cp));
+            *out++ = static_cast<char>(cp);
         }
         else if (cp < 2048) {
-            dest.push_back(
-                static_cast<char>(0xc0 | (static_cast<char>(u32cp >> 6))));
-            dest.push_back(
-                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f)));
+            *out++ = static_cast<char>(0xc0 | (static_cast<char>(u32cp >> 6)));
+            *out++ =
+                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f));
         }
         else if (cp < 65536) {
-            dest.push_back(
-                static_cast<char>(0xe0 | (static_cast<char>(u32cp >> 12))));
-            dest.push_back(static_cast<char>(
-                0x80 | (static_cast<char>(u32cp >> 6) & 0x3f)));
-            dest.push_back(
-                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f)));
+            *out++ =
+                static_cast<char>(0xe0 | (static_cast<char>(u32cp >> 12)));
+            *out++ = static_cast<char>(
+                0x80 | (static_cast<char>(u32cp >> 6) & 0x3f));
+            *out++ =
+                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f));
         }
         else {
-            dest.push_back(
-                static_cast<char>(0xf0 | (static_cast<char>(u32cp >> 18))));
-            dest.push_back(static_cast<char>(
-                0x80 | (static_cast<char>(u32cp >> 12) & 0x3f)));
-            dest.push_back(static_cast<char>(
-                0x80 | (static_cast<char>(u32cp >> 6) & 0x3f)));
-            dest.push_back(
-                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f)));
+            *out++ =
+                static_cast<char>(0xf0 | (static_cast<char>(u32cp >> 18)));
+            *out++ = static_cast<char>(
+                0x80 | (static_cast<char>(u32cp >> 12) & 0x3f));
+            *out++ = static_cast<char>(
+                0x80 | (static_cast<char>(u32cp >> 6) & 0x3f));
+            *out++ =
+                static_cast<char>(0x80 | (static_cast<char>(u32cp) & 0x3f));
         }
     }
+
+    dest.resize(static_cast<std::size_t>(out - dest.data()));
 }
 
 template <bool VerifiedValid, typename SourceCharT, typename DestCharT>
@@ -1883,7 +2019,7 @@ void transcode_to_string_impl_32to16(std::basic_string_view<SourceCharT> src,
             dest.push_back(
                 static_cast<char16_t>((u32cp - 0x10000) / 0x400 + 0xd800));
             dest.push_back(
-                static_cast<char16_t>((u32cp - 0x10000) % 0x400 + 0xd800));
+                static_cast<char16_t>((u32cp - 0x10000) % 0x400 + 0xdc00));
         }
     }
 }
@@ -1895,15 +2031,7 @@ void transcode_to_string(std::basic_string_view<SourceCharT> src,
     static_assert(sizeof(SourceCharT) != sizeof(DestCharT));
 
     if constexpr (sizeof(SourceCharT) == 1) {
-        if constexpr (sizeof(DestCharT) == 2) {
-            std::u32string tmp;
-            transcode_to_string_impl_to32(src, tmp);
-            return transcode_to_string_impl_32to16<false>(
-                std::u32string_view{tmp}, dest);
-        }
-        else if constexpr (sizeof(DestCharT) == 4) {
-            return transcode_to_string_impl_to32(src, dest);
-        }
+        return transcode_to_string_impl_8to16or32<false>(src, dest);
     }
     else if constexpr (sizeof(SourceCharT) == 2) {
         if constexpr (sizeof(DestCharT) == 1) {
@@ -1936,16 +2064,7 @@ void transcode_valid_to_string(std::basic_string_view<SourceCharT> src,
 
     SCN_EXPECT(validate_unicode(src));
     if constexpr (sizeof(SourceCharT) == 1) {
-        if constexpr (sizeof(DestCharT) == 2) {
-            // TODO: Optimize, remove utf32-step, go direct utf8->utf16
-            std::u32string tmp;
-            transcode_valid_to_string_impl_to32(src, tmp);
-            return transcode_to_string_impl_32to16<true>(
-                std::u32string_view{tmp}, dest);
-        }
-        else if constexpr (sizeof(DestCharT) == 4) {
-            return transcode_valid_to_string_impl_to32(src, dest);
-        }
+        return transcode_to_string_impl_8to16or32<true>(src, dest);
     }
     else if constexpr (sizeof(SourceCharT) == 2) {
         if constexpr (sizeof(DestCharT) == 1) {
@@ -2947,34 +3066,21 @@ auto apply_opt(Expected<Iterator>&& result, Range range)
 // Text width calculation
 /////////////////////////////////////////////////////////////////
 
-constexpr std::size_t calculate_text_width_for_fmt_v10(char32_t cp)
+constexpr std::size_t calculate_code_point_text_width(char32_t cp)
 {
-    if (cp >= 0x1100 &&
-        (cp <= 0x115f ||  // Hangul Jamo init. consonants
-         cp == 0x2329 ||  // LEFT-POINTING ANGLE BRACKET
-         cp == 0x232a ||  // RIGHT-POINTING ANGLE BRACKET
-         // CJK ... Yi except IDEOGRAPHIC HALF FILL SPACE:
-         (cp >= 0x2e80 && cp <= 0xa4cf && cp != 0x303f) ||
-         (cp >= 0xac00 && cp <= 0xd7a3) ||    // Hangul Syllables
-         (cp >= 0xf900 && cp <= 0xfaff) ||    // CJK Compatibility Ideographs
-         (cp >= 0xfe10 && cp <= 0xfe19) ||    // Vertical Forms
-         (cp >= 0xfe30 && cp <= 0xfe6f) ||    // CJK Compatibility Forms
-         (cp >= 0xff00 && cp <= 0xff60) ||    // Fullwidth Forms
-         (cp >= 0xffe0 && cp <= 0xffe6) ||    // Fullwidth Forms
-         (cp >= 0x20000 && cp <= 0x2fffd) ||  // CJK
-         (cp >= 0x30000 && cp <= 0x3fffd) ||
-         // Miscellaneous Symbols and Pictographs + Emoticons:
-         (cp >= 0x1f300 && cp <= 0x1f64f) ||
-         // Supplemental Symbols and Pictographs:
-         (cp >= 0x1f900 && cp <= 0x1f9ff))) {
-        return 2;
-    }
-    return 1;
+    // Nothing before U+1100 (Hangul Jamo) is double-wide
+    if (cp < 0x1100 || cp >= width_table::end) {
+        return 1;
+    }
+    const auto cp_val = static_cast<uint32_t>(cp);
+    const auto block = width_table::stage1[cp_val >> width_table::block_shift];
+    const auto offset = cp_val & 0xffu;
+    return 1u + ((width_table::blocks[block][offset / 8] >> (offset % 8)) & 1u);
 }
 
 constexpr std::size_t calculate_valid_text_width(char32_t cp)
 {
-    return calculate_text_width_for_fmt_v10(cp);
+    return calculate_code_point_text_width(cp);
 }
 
 template <typename CharT>
@@ -2982,14 +3088,14 @@ std::size_t calculate_valid_text_width(std::basic_string_view<CharT> input)
 {
     size_t count{0};
     for_each_code_point_valid(input, [&count](char32_t cp) {
-        count += calculate_text_width_for_fmt_v10(cp);
+        count += calculate_code_point_text_width(cp);
     });
     return count;
 }
 
 constexpr std::size_t calculate_text_width(char32_t cp)
 {
-    return calculate_text_width_for_fmt_v10(cp);
+    return calculate_code_point_text_width(cp);
 }
 
 template <typename CharT>
@@ -2997,7 +3103,7 @@ std::size_t calculate_text_width(std::basic_string_view<CharT> input)
 {
     size_t count{0};
     for_each_code_point(input, [&count](char32_t cp) {
-        count += calculate_text_width_for_fmt_v10(cp);
+        count += calculate_code_point_text_width(cp);
     });
     return count;
 }
@@ -3493,6 +3599,44 @@ struct _take_width_fn {
 };
 
 inline constexpr _take_width_fn take_width{};
+
+// Every ASCII character has a width of 1, so if the first `max_width` code
+// units of a contiguous range are ASCII, a width-limited read can be bounded
+// by a plain iterator instead of going through take_width_view.
+// Returns the bound, or `nullopt` if the range has non-ASCII in that span.
+template <typename Range>
+auto find_ascii_width_bound(Range range, std::ptrdiff_t max_width)
+    -> std::optional<ranges::iterator_t<Range>>
+{
+    if constexpr (ranges::contiguous_range<Range> &&
+                  ranges::sized_range<Range>) {
+        SCN_EXPECT(max_width > 0);
+        const auto size = (std::min)(ranges::ssize(range), max_width);
+        const auto data = detail::to_address(range.begin());
+
+        std::ptrdiff_t i = 0;
+        if constexpr (sizeof(*data) == 1) {
+            for (; size - i >= 8; i += 8) {
+                uint64_t word{};
+                std::memcpy(&word, data + i, 8);
+                if (has_byte_greater(word, 127) != 0) {
+                    return std::nullopt;
+                }
+            }
+        }
+        for (; i < size; ++i) {
+            if (!is_ascii_char(data[i])) {
+                return std::nullopt;
+            }
+        }
+        return ranges::next(range.begin(), size);
+    }
+    else {
+        SCN_UNUSED(range);
+        SCN_UNUSED(max_width);
+        return std::nullopt;
+    }
+}
 }  // namespace impl
 
 namespace ranges {
@@ -4995,26 +5139,148 @@ inline auto make_regex_flags(detail::regex_flags flags)
 }
 #endif  // SCN_REGEX_BACKEND == ...
 
-template <typename CharT, typename Input>
-auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
-                            detail::regex_flags flags,
-                            Input input)
-    -> scan_expected<ranges::iterator_t<Input>>
-{
-    static_assert(std::is_same_v<ranges::range_value_t<Input>, CharT>);
-
 #if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
-    std::basic_regex<CharT> re{};
+template <typename CharT>
+auto compile_regex(std::basic_string_view<CharT> pattern,
+                   detail::regex_flags flags)
+    -> scan_expected<std::unique_ptr<std::basic_regex<CharT>>>
+{
     try {
         SCN_TRY(re_flags, make_regex_flags(flags));
-        re = std::basic_regex<CharT>{pattern.data(), pattern.size(),
-                                     re_flags | std::regex_constants::nosubs};
+        return std::make_unique<std::basic_regex<CharT>>(
+            pattern.data(), pattern.size(), re_flags);
     }
     catch (const std::regex_error&) {
         return detail::unexpected_scan_error(scan_error::invalid_format_string,
                                              "Invalid regex");
     }
+}
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
+template <typename CharT>
+auto compile_regex(std::basic_string_view<CharT> pattern,
+                   detail::regex_flags flags)
+    -> scan_expected<std::unique_ptr<decltype(make_regex(
+        pattern,
+        boost::regex_constants::syntax_option_type{}))>>
+{
+    auto re = std::make_unique<decltype(make_regex(
+        pattern, boost::regex_constants::syntax_option_type{}))>(
+        make_regex(pattern, make_regex_flags(flags) | boost::regex::no_except));
+    if (re->status() != 0) {
+        return detail::unexpected_scan_error(scan_error::invalid_format_string,
+                                             "Invalid regex");
+    }
+    return re;
+}
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
+template <typename CharT>
+auto compile_regex(std::basic_string_view<CharT> pattern,
+                   detail::regex_flags flags)
+    -> scan_expected<std::unique_ptr<re2::RE2>>
+{
+    static_assert(std::is_same_v<CharT, char>);
+
+    auto [opts, flagstr] = make_regex_flags(flags);
+    std::unique_ptr<re2::RE2> re{};
+    if (flagstr.empty()) {
+        re = std::make_unique<re2::RE2>(pattern, opts);
+    }
+    else {
+        std::string flagged_pattern{};
+        flagged_pattern.reserve(flagstr.size() + pattern.size());
+        flagged_pattern.append(flagstr);
+        flagged_pattern.append(pattern);
+        re = std::make_unique<re2::RE2>(flagged_pattern, opts);
+    }
+    if (!re->ok()) {
+        return detail::unexpected_scan_error(
+            scan_error::invalid_format_string,
+            "Failed to parse regular expression");
+    }
+    return re;
+}
+#endif  // SCN_REGEX_BACKEND == ...
+
+// The regex type of the backend, for patterns of type CharT
+template <typename CharT>
+using regex_type = typename decltype(compile_regex(
+    std::basic_string_view<CharT>{},
+    detail::regex_flags::none))::value_type::element_type;
+
+// Compiled regexes, keyed by pattern and flags.
+// Holds at most `max_size` regexes, evicting the least recently used one.
+template <typename CharT, typename Regex>
+class regex_cache {
+public:
+    static constexpr std::size_t max_size = 16;
+
+    auto get(std::basic_string_view<CharT> pattern, detail::regex_flags flags)
+        -> scan_expected<const Regex*>
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->flags == flags && it->pattern == pattern) {
+                // Move to front
+                std::rotate(m_entries.begin(), it, std::next(it));
+                return m_entries.front().regex.get();
+            }
+        }
+
+        SCN_TRY(regex, compile_regex(pattern, flags));
+        if (m_entries.size() == max_size) {
+            m_entries.pop_back();
+        }
+        m_entries.insert(m_entries.begin(),
+                         entry{std::basic_string<CharT>{pattern}, flags,
+                               SCN_MOVE(regex)});
+        return m_entries.front().regex.get();
+    }
+
+private:
+    struct entry {
+        std::basic_string<CharT> pattern;
+        detail::regex_flags flags;
+        std::unique_ptr<Regex> regex;
+    };
+
+    std::vector<entry> m_entries{};
+};
+
+// Returns a compiled regex for `pattern` and `flags`, compiling it only if
+// it's not already in the cache of the calling thread.
+// The returned pointer is valid until the next call on the same thread.
+template <typename CharT>
+auto get_cached_regex(std::basic_string_view<CharT> pattern,
+                      detail::regex_flags flags)
+{
+    thread_local regex_cache<CharT, regex_type<CharT>> cache{};
+    return cache.get(pattern, flags);
+}
+
+// The text [first, last) of a regex match, as a view.
+// If the iterators aren't contiguous, the text is copied into `buf`.
+template <typename CharT, typename It>
+std::basic_string_view<CharT> get_regex_match_text(
+    It first,
+    It last,
+    std::basic_string<CharT>& buf)
+{
+    if constexpr (ranges::contiguous_iterator<It>) {
+        return detail::make_string_view_from_pointers(detail::to_address(first),
+                                                      detail::to_address(last));
+    }
+    else {
+        buf.assign(first, last);
+        return buf;
+    }
+}
 
+template <typename CharT, typename Regex, typename Input>
+auto match_regex_string(const Regex& re, Input input)
+    -> scan_expected<ranges::iterator_t<Input>>
+{
+    static_assert(std::is_same_v<ranges::range_value_t<Input>, CharT>);
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
     auto common_input = ranges::views::common(input);
     std::match_results<decltype(common_input.begin())> matches{};
     try {
@@ -5036,14 +5302,6 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
     SCN_ENSURE(matches.ready());
     return std::next(input.begin(), matches.length(0));
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
-    auto re =
-        make_regex(pattern, make_regex_flags(flags) | boost::regex::no_except |
-                                boost::regex::nosubs);
-    if (re.status() != 0) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
-    }
-
     auto regex_input = make_regex_input<CharT>(input);
     boost::match_results<decltype(regex_input.begin())> matches{};
     try {
@@ -5083,24 +5341,6 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 #endif
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
     static_assert(std::is_same_v<CharT, char>);
-    std::string flagged_pattern{};
-    auto re = [&]() {
-        auto [opts, flagstr] = make_regex_flags(flags);
-        opts.set_never_capture(true);
-        if (flagstr.empty()) {
-            return re2::RE2{pattern, opts};
-        }
-        flagged_pattern.reserve(flagstr.size() + pattern.size());
-        flagged_pattern.append(flagstr);
-        flagged_pattern.append(pattern);
-        return re2::RE2{flagged_pattern, opts};
-    }();
-    if (!re.ok()) {
-        return detail::unexpected_scan_error(
-            scan_error::invalid_format_string,
-            "Failed to parse regular expression");
-    }
-
     if (!is_entire_source_contiguous(input)) {
         return detail::unexpected_scan_error(
             scan_error::insufficient_source,
@@ -5121,28 +5361,22 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 #endif  // SCN_REGEX_BACKEND == ...
 }
 
-template <typename CharT, typename Input>
-auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
-                             detail::regex_flags flags,
-                             Input input,
-                             basic_regex_matches<CharT>& value)
+// `pattern` is only used by the Boost backend, to find the names of captures
+template <typename CharT, typename Regex, typename Input>
+auto match_regex_matches(const Regex& re,
+                         std::basic_string_view<CharT> pattern,
+                         Input input,
+                         basic_regex_matches<CharT>& value)
     -> scan_expected<ranges::iterator_t<Input>>
 {
     static_assert(std::is_same_v<ranges::range_value_t<Input>, CharT>);
 
 #if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
-    std::basic_regex<CharT> re{};
-    try {
-        SCN_TRY(re_flags, make_regex_flags(flags));
-        re = std::basic_regex<CharT>{pattern.data(), pattern.size(), re_flags};
-    }
-    catch (const std::regex_error&) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
-    }
+    SCN_UNUSED(pattern);
 
     auto common_input = ranges::views::common(input);
-    std::match_results<decltype(common_input.begin())> matches{};
+    // Reused across calls, to avoid allocating every time
+    thread_local std::match_results<decltype(common_input.begin())> matches{};
     try {
         bool found =
             std::regex_search(common_input.begin(), common_input.end(), matches,
@@ -5161,24 +5395,24 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
 
     SCN_ENSURE(matches.ready());
 
-    auto full_match = matches[0].str();
-    std::vector<typename basic_regex_matches<CharT>::submatch> submatches(
-        matches.size() - 1);
+    std::basic_string<CharT> buf{};
+    value.reset(get_regex_match_text(matches[0].first, matches[0].second, buf),
+                matches.size() - 1);
 
     for (std::size_t i = 1; i < matches.size(); ++i) {
         if (!matches[i].matched) {
             continue;
         }
-        submatches[i - 1].pos = static_cast<std::size_t>(matches.position(i));
-        submatches[i - 1].len = static_cast<std::size_t>(matches.length(i));
+        value.set_submatch(i, static_cast<std::size_t>(matches.position(i)),
+                           static_cast<std::size_t>(matches.length(i)));
     }
 
-    value =
-        basic_regex_matches<CharT>{SCN_MOVE(full_match), SCN_MOVE(submatches)};
-
     return std::next(input.begin(), matches.length(0));
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
-    std::vector<std::basic_string<CharT>> names;
+    // Views into `pattern`, reused across calls
+    thread_local std::vector<std::basic_string_view<CharT>> names{};
+    names.clear();
+    std::size_t names_size = 0;
     for (size_t i = 0; i < pattern.size();) {
         if constexpr (std::is_same_v<CharT, char>) {
             i = pattern.find("(?<", i);
@@ -5202,18 +5436,13 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
         if (end_i == std::basic_string_view<CharT>::npos) {
             break;
         }
-        names.emplace_back(pattern.substr(i, end_i - i));
-    }
-
-    auto re =
-        make_regex(pattern, make_regex_flags(flags) | boost::regex::no_except);
-    if (re.status() != 0) {
-        return detail::unexpected_scan_error(scan_error::invalid_format_string,
-                                             "Invalid regex");
+        names.push_back(pattern.substr(i, end_i - i));
+        names_size += end_i - i;
     }
 
     auto regex_input = make_regex_input<CharT>(input);
-    boost::match_results<decltype(regex_input.begin())> matches{};
+    // Reused across calls, to avoid allocating every time
+    thread_local boost::match_results<decltype(regex_input.begin())> matches{};
 
     try {
         bool found = do_regex_search(re, regex_input, matches);
@@ -5234,21 +5463,22 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
             "Regex matching failed with invalid encoding");
     }
 
-    std::vector<typename basic_regex_matches<CharT>::submatch> submatches(
-        matches.size() - 1);
-
 #if !SCN_REGEX_BOOST_USE_ICU
-    auto full_match = matches[0].str();
+    std::basic_string<CharT> buf{};
+    const auto full_match =
+        get_regex_match_text(matches[0].first, matches[0].second, buf);
+    value.reset(full_match, matches.size() - 1, names_size);
 
     for (std::size_t i = 1; i < matches.size(); ++i) {
         if (!matches[static_cast<int>(i)].matched) {
             continue;
         }
 
-        submatches[i - 1].pos = static_cast<std::size_t>(
-            matches.position(static_cast<unsigned>(i)));
-        submatches[i - 1].len =
-            static_cast<std::size_t>(matches.length(static_cast<int>(i)));
+        value.set_submatch(
+            i,
+            static_cast<std::size_t>(
+                matches.position(static_cast<unsigned>(i))),
+            static_cast<std::size_t>(matches.length(static_cast<int>(i))));
     }
 #else
     auto u32_full_match = matches[0].str();
@@ -5263,6 +5493,7 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
                 typename decltype(u32_full_match)::value_type>{u32_full_match},
             full_match);
     }
+    value.reset(full_match, matches.size() - 1, names_size);
 
     auto get_source_iterator = [&](auto it) {
         if constexpr (sizeof(CharT) == sizeof(char32_t)) {
@@ -5282,44 +5513,24 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
 
         const auto beg = get_source_iterator(match.first);
         const auto end = get_source_iterator(match.second);
-        submatches[i - 1].pos =
-            static_cast<std::size_t>(std::distance(src_beg, beg));
-        submatches[i - 1].len =
-            static_cast<std::size_t>(std::distance(beg, end));
+        value.set_submatch(
+            i, static_cast<std::size_t>(std::distance(src_beg, beg)),
+            static_cast<std::size_t>(std::distance(beg, end)));
     }
 #endif
-    for (auto& name : names) {
+    for (auto name : names) {
         auto idx = matches.named_subexpression_index(name.data(),
                                                      name.data() + name.size());
         if (idx > 0) {
-            submatches[static_cast<std::size_t>(idx - 1)].name = SCN_MOVE(name);
+            value.set_submatch_name(static_cast<std::size_t>(idx), name);
         }
     }
-    names.clear();
 
     const auto n = static_cast<std::ptrdiff_t>(full_match.size());
-    value =
-        basic_regex_matches<CharT>{SCN_MOVE(full_match), SCN_MOVE(submatches)};
-
     return std::next(input.begin(), n);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
     static_assert(std::is_same_v<CharT, char>);
-    std::string flagged_pattern{};
-    auto re = [&]() {
-        auto [opts, flagstr] = make_regex_flags(flags);
-        if (flagstr.empty()) {
-            return re2::RE2{pattern, opts};
-        }
-        flagged_pattern.reserve(flagstr.size() + pattern.size());
-        flagged_pattern.append(flagstr);
-        flagged_pattern.append(pattern);
-        return re2::RE2{flagged_pattern, opts};
-    }();
-    if (!re.ok()) {
-        return detail::unexpected_scan_error(
-            scan_error::invalid_format_string,
-            "Failed to parse regular expression");
-    }
+    SCN_UNUSED(pattern);
 
     if (!is_entire_source_contiguous(input)) {
         return detail::unexpected_scan_error(
@@ -5350,8 +5561,13 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
         round_up(memory_needed_for(match_args) * max_matches_n,
                  alignof(std::max_align_t)) +
         (memory_needed_for(match_argptrs) * max_matches_n);
-    auto memory =
-        std::unique_ptr<unsigned char[]>(new unsigned char[memory_needed]);
+    // Reused across calls, to avoid allocating every time
+    thread_local std::unique_ptr<unsigned char[]> memory{};
+    thread_local std::size_t memory_size{0};
+    if (memory_size < memory_needed) {
+        memory.reset(new unsigned char[memory_needed]);
+        memory_size = memory_needed;
+    }
 
     {
         auto* ptr = memory.get();
@@ -5380,13 +5596,14 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
                                              "Regular expression didn't match");
     }
 
-    std::basic_string<CharT> full_match{};
-    full_match.assign(contiguous_input.data(),
-                      static_cast<std::size_t>(std::distance(
-                          contiguous_input.data(), new_input.data())));
+    std::size_t names_size = 0;
+    for (const auto& group : re.CapturingGroupNames()) {
+        names_size += group.second.size();
+    }
+    value.reset(detail::make_string_view_from_pointers(
+                    contiguous_input.data(), new_input.data()),
+                max_matches_n, names_size);
 
-    std::vector<typename basic_regex_matches<CharT>::submatch> submatches{
-        max_matches_n};
     for (std::size_t i = 0; i < max_matches_n; ++i) {
         auto match = matches[i];
         {
@@ -5402,24 +5619,45 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
             continue;
         }
 
-        submatches[i].pos = static_cast<std::size_t>(
-            std::distance(contiguous_input.data(), match->data()));
-        submatches[i].len = match->size();
+        value.set_submatch(i + 1,
+                           static_cast<std::size_t>(std::distance(
+                               contiguous_input.data(), match->data())),
+                           match->size());
 
         if (auto it = re.CapturingGroupNames().find(static_cast<int>(i + 1));
             it != re.CapturingGroupNames().end()) {
-            submatches[i].name = it->second;
+            value.set_submatch_name(i + 1, it->second);
         }
     }
 
-    value =
-        basic_regex_matches<CharT>{SCN_MOVE(full_match), SCN_MOVE(submatches)};
-
     return std::next(input.begin(),
                      std::distance(contiguous_input.data(), new_input.data()));
 #endif  // SCN_REGEX_BACKEND == ...
 }
 
+template <typename CharT, typename Input>
+auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
+                            detail::regex_flags flags,
+                            Input input)
+    -> scan_expected<ranges::iterator_t<Input>>
+{
+    // Submatches aren't needed
+    SCN_TRY(re, get_cached_regex(pattern,
+                                 flags | detail::regex_flags::nocapture));
+    return match_regex_string<CharT>(*re, input);
+}
+
+template <typename CharT, typename Input>
+auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
+                             detail::regex_flags flags,
+                             Input input,
+                             basic_regex_matches<CharT>& value)
+    -> scan_expected<ranges::iterator_t<Input>>
+{
+    SCN_TRY(re, get_cached_regex(pattern, flags));
+    return match_regex_matches<CharT>(*re, pattern, input, value);
+}
+
 SCN_GCC_PUSH
 SCN_GCC_IGNORE("-Wrestrict")
 
@@ -5760,20 +5998,37 @@ struct nonascii_specs_handler {
             return;
         }
 
-        for (auto& elem : extra_ranges) {
-            // TODO: check for overlap
-            if (elem.first == end) {
-                elem.first = begin;
-                return;
-            }
+        extra_ranges.push_back(std::make_pair(begin, end));
+    }
 
-            if (elem.second == begin) {
-                elem.second = end;
-                return;
+    // Sort the ranges, and merge overlapping and adjacent ones,
+    // so that they can be binary searched
+    void finalize()
+    {
+        std::sort(extra_ranges.begin(), extra_ranges.end());
+
+        auto out = extra_ranges.begin();
+        for (auto it = extra_ranges.begin(); it != extra_ranges.end(); ++it) {
+            if (out != extra_ranges.begin() &&
+                it->first <= std::prev(out)->second) {
+                std::prev(out)->second =
+                    (std::max)(std::prev(out)->second, it->second);
+                continue;
             }
+            *out++ = *it;
         }
+        extra_ranges.erase(out, extra_ranges.end());
+    }
 
-        extra_ranges.push_back(std::make_pair(begin, end));
+    bool contains(char32_t cp) const
+    {
+        auto it = std::upper_bound(
+            extra_ranges.begin(), extra_ranges.end(), cp,
+            [](char32_t val, const auto& range) { return val < range.first; });
+        if (it == extra_ranges.begin()) {
+            return false;
+        }
+        return cp < std::prev(it)->second;
     }
 
     constexpr void on_charset_inverted() const
@@ -5847,19 +6102,8 @@ private:
 
         bool is_char_set_in_extra_literals(char32_t cp) const
         {
-            // TODO: binary search?
-            if (nonascii.extra_ranges.empty()) {
-                return false;
-            }
-
-            const auto cp_val = static_cast<uint32_t>(cp);
-            return std::find_if(
-                       nonascii.extra_ranges.begin(),
-                       nonascii.extra_ranges.end(),
-                       [cp_val](const auto& pair) noexcept {
-                           return static_cast<uint32_t>(pair.first) <= cp_val &&
-                                  static_cast<uint32_t>(pair.second) > cp_val;
-                       }) != nonascii.extra_ranges.end();
+            SCN_EXPECT(nonascii != nullptr);
+            return nonascii->contains(cp);
         }
 
         scan_expected<void> handle_nonascii()
@@ -5868,21 +6112,48 @@ private:
                 return {};
             }
 
-            auto charset_string = specs.get_charset_string<SourceCharT>();
+            // The non-ASCII ranges of recently used character sets are kept
+            // in a small per-thread cache, keyed by the text of the set,
+            // so that scanning with the same format strings repeatedly
+            // doesn't parse and sort them again on every read.
+            // Entries are shared, so that an evicted entry stays alive
+            // for as long as a reader is still using it.
+            struct cache_entry {
+                std::basic_string<SourceCharT> charset;
+                std::shared_ptr<const nonascii_specs_handler> handler;
+            };
+            constexpr std::size_t cache_size = 8;
+            thread_local std::array<cache_entry, cache_size> cache{};
+            thread_local std::size_t next_evicted{0};
+
+            const auto charset_string = specs.get_charset_string<SourceCharT>();
+            for (const auto& entry : cache) {
+                if (entry.handler && charset_string == entry.charset) {
+                    nonascii = entry.handler;
+                    return {};
+                }
+            }
+
+            nonascii_specs_handler handler{};
             auto it = detail::to_address(charset_string.begin());
             auto set = detail::parse_presentation_set(
-                it, detail::to_address(charset_string.end()), nonascii);
-            SCN_TRY_DISCARD(nonascii.get_error());
+                it, detail::to_address(charset_string.end()), handler);
+            SCN_TRY_DISCARD(handler.get_error());
             SCN_ENSURE(it == detail::to_address(charset_string.end()));
             SCN_ENSURE(set == charset_string);
-
-            std::sort(nonascii.extra_ranges.begin(),
-                      nonascii.extra_ranges.end());
+            handler.finalize();
+
+            nonascii = std::make_shared<const nonascii_specs_handler>(
+                SCN_MOVE(handler));
+            auto& entry = cache[next_evicted];
+            next_evicted = (next_evicted + 1) % cache_size;
+            entry.charset.assign(charset_string.data(), charset_string.size());
+            entry.handler = nonascii;
             return {};
         }
 
         const detail::format_specs& specs;
-        nonascii_specs_handler nonascii;
+        std::shared_ptr<const nonascii_specs_handler> nonascii{};
     };
 
     struct read_source_callback {
@@ -6910,11 +7181,29 @@ struct arg_reader {
             }
 
             const auto initial_width = specs.precision - prefix_width;
-            auto max_width_view =
-                take_width(ranges::subrange{it, rng.end()}, initial_width);
-            SCN_TRY(w_it, rd.read_specs(max_width_view, specs, value, loc));
-            it = w_it.base();
-            value_width = initial_width - w_it.count();
+            bool value_read = false;
+            if constexpr (ranges::contiguous_range<Range>) {
+                // Character presentation requires a take_width_view
+                if (const auto ascii_end = find_ascii_width_bound(
+                        ranges::subrange{it, rng.end()}, initial_width);
+                    ascii_end &&
+                    specs.type != detail::presentation_type::character) {
+                    SCN_TRY(value_end,
+                            rd.read_specs(ranges::subrange{it, *ascii_end},
+                                          specs, value, loc));
+                    value_width = ranges::distance(it, value_end);
+                    it = value_end;
+                    value_read = true;
+                }
+            }
+            if (!value_read) {
+                auto max_width_view =
+                    take_width(ranges::subrange{it, rng.end()}, initial_width);
+                SCN_TRY(w_it,
+                        rd.read_specs(max_width_view, specs, value, loc));
+                it = w_it.base();
+                value_width = initial_width - w_it.count();
+            }
         }
         else {
             SCN_TRY_ASSIGN(it, rd.read_specs(ranges::subrange{it, rng.end()},
@@ -31,7 +31,10 @@ module;
 #endif
 
 #include <scn/chrono.h>
+#include <scn/columns.h>
 #include <scn/istream.h>
+#include <scn/parallel.h>
+#include <scn/parsed_format.h>
 #include <scn/ranges.h>
 #include <scn/regex.h>
 #include <scn/scan.h>
@@ -204,16 +207,46 @@ using scn::September;
 using scn::datetime_components;
 using scn::tm_with_tz;
 
+using scn::scan_chrono_batch;
+
+using scn::get_tz_abbreviation_resolver;
+using scn::resolve_common_tz_abbreviation;
+using scn::set_tz_abbreviation_resolver;
+using scn::tz_abbreviation_resolver;
+
+// columns.h
+
+using scn::column_row_error;
+using scn::scan_columns_result;
+
+// parsed_format.h
+
+using scn::basic_parsed_format;
+using scn::make_parsed_format;
+using scn::parsed_format;
+using scn::wparsed_format;
+
+using scn::scan_columns;
+
+// parallel.h
+
+using scn::for_each_line_parallel;
+using scn::scan_columns_parallel;
+using scn::scan_parallel_options;
+
 // ranges.h
 
+using scn::duplicate_key_policy;
 using scn::range_format;
 using scn::range_format_kind;
 using scn::range_scanner;
+using scn::span_out;
 
 // regex.h
 
 using scn::basic_regex_match;
 using scn::basic_regex_matches;
+using scn::regex_ref;
 
 SCN_END_NAMESPACE
 }  // namespace scn
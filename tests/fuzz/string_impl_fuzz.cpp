@@ -44,6 +44,9 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
     do_find(sv, scn::impl::find_classic_nonspace_narrow_fast);
     do_find(sv, scn::impl::find_nondecimal_digit_narrow_fast);
 
+    SCN_ENSURE(scn::impl::validate_utf8_fast(sv) ==
+               scn::impl::validate_unicode_scalar(sv));
+
     std::wstring widened{};
     scn::impl::transcode_to_string(sv, widened);
 
@@ -637,3 +637,24 @@ TEST(CustomPrecisionTest, Fuzz1)
     EXPECT_EQ(r->value(), "a");
     EXPECT_STREQ(r->begin(), "😂");
 }
+
+TEST(CustomPrecisionTest, AsciiThenNonAscii)
+{
+    auto r = scn::scan<std::string>("abcåäö", "{:.4}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "abcå");
+    EXPECT_STREQ(r->begin(), "äö");
+}
+
+TEST(CustomPrecisionTest, FixedWidthRecord)
+{
+    auto r = scn::scan<int, std::string, int, std::string>(
+        "0042ABCDEFGH123456xyz", "{:.4}{:.8}{:.6}{:.8}");
+    ASSERT_TRUE(r);
+    auto [a, b, c, d] = r->values();
+    EXPECT_EQ(a, 42);
+    EXPECT_EQ(b, "ABCDEFGH");
+    EXPECT_EQ(c, 123456);
+    EXPECT_EQ(d, "xyz");
+    EXPECT_STREQ(r->begin(), "");
+}
@@ -22,6 +22,12 @@
 #if !SCN_DISABLE_CHRONO
 
 #include <scn/chrono.h>
+#include <scn/ranges.h>
+
+#include <cctype>
+#include <cstdint>
+#include <deque>
+#include <vector>
 
 namespace {
 
@@ -120,6 +126,81 @@ TEST(ChronoScanTest, Timezone)
     EXPECT_EQ(result->value().tz_name, "Europe/Helsinki");
 }
 
+TEST(ChronoScanTest, TimezoneNameResolved)
+{
+    auto result = scn::scan<scn::tm_with_tz>("CEST", "{:%Z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().tz_name, "CEST");
+    EXPECT_EQ(result->value().tz_offset, std::chrono::hours{2});
+
+    auto dt_result = scn::scan<scn::datetime_components>("12:00 PST",
+                                                         "{:%H:%M %Z}");
+    ASSERT_TRUE(dt_result);
+    EXPECT_EQ(dt_result->value().tz_name, "PST");
+    EXPECT_EQ(dt_result->value().tz_offset, std::chrono::hours{-8});
+
+    dt_result = scn::scan<scn::datetime_components>("12:00 Europe/Helsinki",
+                                                    "{:%H:%M %Z}");
+    ASSERT_TRUE(dt_result);
+    EXPECT_EQ(dt_result->value().tz_name, "Europe/Helsinki");
+    EXPECT_FALSE(dt_result->value().tz_offset);
+
+    dt_result = scn::scan<scn::datetime_components>("12:00 ", "{:%H:%M %Z}");
+    ASSERT_FALSE(dt_result);
+    EXPECT_EQ(dt_result.error().code(),
+              scn::scan_error::invalid_scanned_value);
+}
+
+TEST(ChronoScanTest, CommonTimezoneAbbreviations)
+{
+    EXPECT_EQ(scn::resolve_common_tz_abbreviation("UTC"),
+              std::chrono::minutes{0});
+    EXPECT_EQ(scn::resolve_common_tz_abbreviation("Z"),
+              std::chrono::minutes{0});
+    EXPECT_EQ(scn::resolve_common_tz_abbreviation("ACST"),
+              std::chrono::minutes{9 * 60 + 30});
+    EXPECT_EQ(scn::resolve_common_tz_abbreviation("NST"),
+              std::chrono::minutes{-3 * 60 - 30});
+    EXPECT_FALSE(scn::resolve_common_tz_abbreviation("IST"));
+    EXPECT_FALSE(scn::resolve_common_tz_abbreviation("AST"));
+    EXPECT_FALSE(scn::resolve_common_tz_abbreviation("BST"));
+    EXPECT_FALSE(scn::resolve_common_tz_abbreviation("utc"));
+    EXPECT_FALSE(scn::resolve_common_tz_abbreviation(""));
+}
+
+std::optional<std::chrono::minutes> test_tz_resolver(std::string_view name)
+{
+    if (name == "IST") {
+        return std::chrono::minutes{5 * 60 + 30};
+    }
+    return scn::resolve_common_tz_abbreviation(name);
+}
+
+TEST(ChronoScanTest, CustomTimezoneResolver)
+{
+    auto prev = scn::set_tz_abbreviation_resolver(&test_tz_resolver);
+    EXPECT_EQ(prev, &scn::resolve_common_tz_abbreviation);
+
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::seconds>;
+    auto result = scn::scan<time_point>("1970-01-01 05:30:00 IST",
+                                        "{:%Y-%m-%d %H:%M:%S %Z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(), std::chrono::seconds{0});
+
+    scn::set_tz_abbreviation_resolver(nullptr);
+    auto dt_result = scn::scan<scn::datetime_components>("UTC", "{:%Z}");
+    ASSERT_TRUE(dt_result);
+    EXPECT_EQ(dt_result->value().tz_name, "UTC");
+    EXPECT_FALSE(dt_result->value().tz_offset);
+
+    result = scn::scan<time_point>("1970-01-01 05:30:00 UTC",
+                                   "{:%Y-%m-%d %H:%M:%S %Z}");
+    ASSERT_FALSE(result);
+
+    scn::set_tz_abbreviation_resolver(prev);
+}
+
 TEST(ChronoScanTest, ShortYearAndCentury)
 {
     auto result = scn::scan<std::tm>("2024", "{:%C%y}");
@@ -219,6 +300,50 @@ TEST(ChronoScanTest, MonthByName)
     ASSERT_FALSE(result);
 }
 
+TEST(ChronoScanTest, AllMonthAndWeekdayNames)
+{
+    const std::string months[] = {
+        "January", "February", "March",     "April",   "May",      "June",
+        "July",    "August",   "September", "October", "November", "December"};
+    for (int i = 0; i < 12; ++i) {
+        SCOPED_TRACE(months[i]);
+        for (auto name : {months[i], months[i].substr(0, 3)}) {
+            auto upper = name;
+            for (auto& ch : upper) {
+                ch = static_cast<char>(std::toupper(ch));
+            }
+            for (const auto& input : {name, upper}) {
+                auto result = scn::scan<std::tm>(input + "!", "{:%b}!");
+                ASSERT_TRUE(result) << input;
+                EXPECT_EQ(result->value().tm_mon, i);
+
+                auto source = std::deque<char>(input.begin(), input.end());
+                auto deque_result = scn::scan<std::tm>(source, "{:%B}");
+                ASSERT_TRUE(deque_result) << input;
+                EXPECT_EQ(deque_result->value().tm_mon, i);
+                EXPECT_EQ(deque_result->begin(), source.end());
+            }
+        }
+    }
+
+    const std::string weekdays[] = {"Sunday",   "Monday", "Tuesday",
+                                    "Wednesday", "Thursday", "Friday",
+                                    "Saturday"};
+    for (int i = 0; i < 7; ++i) {
+        SCOPED_TRACE(weekdays[i]);
+        for (auto name : {weekdays[i], weekdays[i].substr(0, 3)}) {
+            auto result = scn::scan<std::tm>(name + "!", "{:%a}!");
+            ASSERT_TRUE(result) << name;
+            EXPECT_EQ(result->value().tm_wday, i);
+        }
+    }
+
+    EXPECT_FALSE(scn::scan<std::tm>("Ja", "{:%b}"));
+    EXPECT_FALSE(scn::scan<std::tm>("Jen", "{:%b}"));
+    EXPECT_FALSE(scn::scan<std::tm>("Sux", "{:%a}"));
+    EXPECT_FALSE(scn::scan<std::tm>("J4n", "{:%b}"));
+}
+
 TEST(ChronoScanTest, Weekday)
 {
     auto result = scn::scan<std::tm>("0", "{:%w}");
@@ -303,19 +428,318 @@ TEST(ChronoScanTest, ChronoTimePoint)
     auto val = std::chrono::duration_cast<std::chrono::seconds>(
         result->value().time_since_epoch());
 
-    std::tm expected_tm{};
-    expected_tm.tm_sec = 10;
-    expected_tm.tm_min = 11;
-    expected_tm.tm_hour = 23;
-    expected_tm.tm_mday = 10;
-    expected_tm.tm_mon = 8;
-    expected_tm.tm_year = 2024 - 1900;
-    expected_tm.tm_wday = 0;
-    expected_tm.tm_yday = 0;
-    expected_tm.tm_isdst = -1;
-    auto expected_val = std::chrono::seconds{std::mktime(&expected_tm)};
-
-    EXPECT_EQ(val, expected_val);
+    // sys_time is in UTC, regardless of the local time zone
+    EXPECT_EQ(val, std::chrono::seconds{1726009870});
+}
+
+TEST(ChronoScanTest, ChronoTimePointWithOffsetAndSubseconds)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::milliseconds>;
+    auto result = scn::scan<time_point>("2024-09-10T23:11:10.25+02:00",
+                                        "{:%Y-%m-%dT%H:%M:%.S%z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              std::chrono::milliseconds{1726002670250});
+}
+
+TEST(ChronoScanTest, ChronoTimePointBeforeEpoch)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::seconds>;
+    auto result =
+        scn::scan<time_point>("1969-12-31 23:59:59", "{:%Y-%m-%d %H:%M:%S}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(), std::chrono::seconds{-1});
+
+    using day_point = std::chrono::time_point<
+        std::chrono::system_clock,
+        std::chrono::duration<int, std::ratio<86400>>>;
+    auto day_result = scn::scan<day_point>("1969-12-31 23:59", "{:%F %R}");
+    ASSERT_TRUE(day_result);
+    EXPECT_EQ(day_result->value().time_since_epoch().count(), -1);
+}
+
+TEST(ChronoScanTest, ChronoTimePointInvalidDate)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::seconds>;
+    EXPECT_TRUE(scn::scan<time_point>("2024-02-29", "{:%Y-%m-%d}"));
+    auto result = scn::scan<time_point>("2023-02-29", "{:%Y-%m-%d}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(ChronoScanTest, ChronoTimePointOverflow)
+{
+    using time_point =
+        std::chrono::time_point<std::chrono::system_clock,
+                                std::chrono::duration<std::int32_t>>;
+    EXPECT_TRUE(scn::scan<time_point>("2038-01-19 03:14:07", "{:%F %T}"));
+    auto result = scn::scan<time_point>("2038-01-19 03:14:08", "{:%F %T}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_FALSE(scn::scan<time_point>("2100-01-01", "{:%Y-%m-%d}"));
+    EXPECT_TRUE(scn::scan<time_point>("1901-12-13 20:45:52", "{:%F %T}"));
+    EXPECT_FALSE(scn::scan<time_point>("1901-12-13 20:45:51", "{:%F %T}"));
+
+    using unsigned_point =
+        std::chrono::time_point<std::chrono::system_clock,
+                                std::chrono::duration<std::uint32_t>>;
+    EXPECT_FALSE(scn::scan<unsigned_point>("1969-12-31", "{:%Y-%m-%d}"));
+
+    using ms_point =
+        std::chrono::time_point<std::chrono::system_clock,
+                                std::chrono::duration<std::int32_t, std::milli>>;
+    EXPECT_TRUE(scn::scan<ms_point>("1970-01-25", "{:%Y-%m-%d}"));
+    EXPECT_FALSE(scn::scan<ms_point>("1970-01-26", "{:%Y-%m-%d}"));
+}
+
+TEST(ChronoScanTest, ChronoTimePointTickCount)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::seconds>;
+    auto result = scn::scan<time_point>("1726009870", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().time_since_epoch(),
+              std::chrono::seconds{1726009870});
+}
+
+TEST(ChronoScanTest, DaysFromCivil)
+{
+    EXPECT_EQ(scn::detail::days_from_civil(1970, 1, 1), 0);
+    EXPECT_EQ(scn::detail::days_from_civil(1969, 12, 31), -1);
+    EXPECT_EQ(scn::detail::days_from_civil(2000, 3, 1), 11017);
+    EXPECT_EQ(scn::detail::days_from_civil(1600, 2, 29), -135081);
+}
+
+TEST(ChronoScanTest, ChronoDuration)
+{
+    auto result =
+        scn::scan<std::chrono::milliseconds>("01:02:03.5", "{:%H:%M:%.S}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), std::chrono::milliseconds{3723500});
+
+    auto result_ticks = scn::scan<std::chrono::seconds>("-42", "{}");
+    ASSERT_TRUE(result_ticks);
+    EXPECT_EQ(result_ticks->value(), std::chrono::seconds{-42});
+
+    auto result_float =
+        scn::scan<std::chrono::duration<double>>("1.5", "{}");
+    ASSERT_TRUE(result_float);
+    EXPECT_EQ(result_float->value().count(), 1.5);
+}
+
+TEST(ChronoScanTest, ChronoDurationOutOfRange)
+{
+    auto result = scn::scan<std::chrono::duration<std::int16_t>>(
+        "23:00:00", "{:%H:%M:%S}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    auto result_fits = scn::scan<std::chrono::duration<std::int16_t>>(
+        "09:06:07", "{:%H:%M:%S}");
+    ASSERT_TRUE(result_fits);
+    EXPECT_EQ(result_fits->value().count(), 32767);
+}
+
+TEST(ChronoScanTest, ChronoDurationNotRepresentable)
+{
+    auto result =
+        scn::scan<std::chrono::hours>("01:59:59", "{:%H:%M:%S}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    auto result_exact =
+        scn::scan<std::chrono::hours>("02:00:00", "{:%H:%M:%S}");
+    ASSERT_TRUE(result_exact);
+    EXPECT_EQ(result_exact->value(), std::chrono::hours{2});
+
+    auto result_subsec = scn::scan<std::chrono::milliseconds>(
+        "00:00:01.2345", "{:%H:%M:%.S}");
+    ASSERT_FALSE(result_subsec);
+    EXPECT_EQ(result_subsec.error().code(),
+              scn::scan_error::invalid_scanned_value);
+}
+
+TEST(ChronoScanTest, ChronoDurationFloatingPointSubseconds)
+{
+    auto result = scn::scan<std::chrono::duration<double>>("00:00:01.5",
+                                                           "{:%H:%M:%.S}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().count(), 1.5);
+
+    auto result_minutes =
+        scn::scan<std::chrono::duration<double, std::ratio<60>>>(
+            "01:01:30", "{:%H:%M:%S}");
+    ASSERT_TRUE(result_minutes);
+    EXPECT_EQ(result_minutes->value().count(), 61.5);
+}
+
+TEST(ChronoScanTest, ChronoDurationInvalidFormat)
+{
+    auto result = scn::scan<std::chrono::seconds>(
+        "2024-01-01", scn::runtime_format("{:%Y-%m-%d}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(ChronoScanTest, Batch)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::seconds>;
+    std::vector<time_point> column;
+    auto result = scn::scan_chrono_batch(
+        "2024-09-10 23:11:10\n"
+        "2024-09-10 foo\n"
+        "  2024-09-10 23:11:10\r\n"
+        "2023-02-29 00:00:00\n"
+        "1970-01-01 00:00:00",
+        "%F %T", column);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 3);
+    ASSERT_EQ(column.size(), 3);
+    EXPECT_EQ(column[0].time_since_epoch(), std::chrono::seconds{1726009870});
+    EXPECT_EQ(column[1].time_since_epoch(), std::chrono::seconds{1726009870});
+    EXPECT_EQ(column[2].time_since_epoch(), std::chrono::seconds{0});
+
+    ASSERT_EQ(result->errors.size(), 2);
+    EXPECT_EQ(result->errors[0].row, 1);
+    EXPECT_EQ(result->errors[1].row, 3);
+    EXPECT_EQ(result->errors[1].error.code(),
+              scn::scan_error::invalid_scanned_value);
+}
+
+TEST(ChronoScanTest, BatchFixedCapacity)
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock,
+                                               std::chrono::milliseconds>;
+    time_point storage[2]{};
+    auto column = scn::span_out<time_point>{storage};
+    const std::string_view source =
+        "00:00:01.5\n00:00:02.25\n00:00:03\n";
+    auto result = scn::scan_chrono_batch(source, "%H:%M:%.S", column);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 2);
+    EXPECT_EQ(result->consumed, source.find("00:00:03"));
+    EXPECT_EQ(storage[0].time_since_epoch(), std::chrono::milliseconds{1500});
+    EXPECT_EQ(storage[1].time_since_epoch(), std::chrono::milliseconds{2250});
+}
+
+TEST(ChronoScanTest, BatchInvalidFormat)
+{
+    std::vector<std::chrono::system_clock::time_point> column;
+    auto result = scn::scan_chrono_batch("2024", "%Y%Q", column);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+
+    result = scn::scan_chrono_batch("2024", "", column);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(ChronoScanTest, BatchWide)
+{
+    std::vector<std::chrono::system_clock::time_point> column;
+    auto result =
+        scn::scan_chrono_batch(L"1970-01-02\n1970-01-03", L"%F", column);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(column.size(), 2);
+    EXPECT_EQ(column[1].time_since_epoch(), std::chrono::hours{48});
+}
+
+TEST(ChronoScanTest, FixedLayouts)
+{
+    auto result = scn::scan<scn::datetime_components>(
+        "2024-08-23T23:06:10.125-04:30", "{:%Y-%m-%dT%H:%M:%.S%z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().year, 2024);
+    EXPECT_EQ(result->value().mon, scn::August);
+    EXPECT_EQ(result->value().mday, 23);
+    EXPECT_EQ(result->value().hour, 23);
+    EXPECT_EQ(result->value().min, 6);
+    EXPECT_EQ(result->value().sec, 10);
+    EXPECT_EQ(result->value().subsec, 0.125);
+    EXPECT_EQ(result->value().tz_offset, std::chrono::minutes{-4 * 60 - 30});
+
+    result = scn::scan<scn::datetime_components>("2024-08-23 23:06:10",
+                                                 "{:%F %T}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().year, 2024);
+    EXPECT_EQ(result->value().sec, 10);
+
+    result = scn::scan<scn::datetime_components>(
+        "10/Oct/2000:13:55:36 -0700", "{:%d/%b/%Y:%H:%M:%S %z}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().mday, 10);
+    EXPECT_EQ(result->value().mon, scn::October);
+    EXPECT_EQ(result->value().year, 2000);
+    EXPECT_EQ(result->value().hour, 13);
+    EXPECT_EQ(result->value().tz_offset, std::chrono::hours{-7});
+}
+
+// Reading from a contiguous source uses the fixed-layout fast path, when
+// possible; reading from a deque never does
+TEST(ChronoScanTest, FixedLayoutMatchesGenericPath)
+{
+    const std::string_view formats[] = {
+        "%Y-%m-%dT%H:%M:%S%z",
+        "%Y-%m-%dT%H:%M:%.S%z",
+        "%F %T",
+        "%d/%b/%Y:%H:%M:%S %z",
+        "%Y-%m-%d %%",
+    };
+    const std::string_view inputs[] = {
+        "2024-08-23T23:06:10+02:00",
+        "2024-08-23T23:06:10.5+0200",
+        "2024-08-23T23:06:10.123456789012345678Z",
+        "2024-8-23T23:06:10+02:00",
+        "2024-08-23T23:06:10+2",
+        "2024-08-23T23:06:10+02:",
+        "2024-08-23T23:06:10+02:0",
+        "2024-13-23T23:06:10+02:00",
+        "2024-08-23 23:06:10",
+        "2024-08-23   23:06:10 trailing",
+        "2024-08-23\t23:06:61",
+        "2024-08-23 %",
+        "10/Oct/2000:13:55:36 -0700",
+        "10/oct/2000:13:55:36 -0700",
+        "10/October/2000:13:55:36 -0700",
+        "10/May/2000:13:55:36 -0700",
+        "10/Foo/2000:13:55:36 -0700",
+        "",
+    };
+
+    for (auto fmt : formats) {
+        for (auto input : inputs) {
+            SCOPED_TRACE(testing::Message() << fmt << " / " << input);
+            const auto format = "{:" + std::string{fmt} + "}";
+            auto contiguous = scn::scan<scn::datetime_components>(
+                input, scn::runtime_format(format));
+            auto source = std::deque<char>(input.begin(), input.end());
+            auto generic = scn::scan<scn::datetime_components>(
+                source, scn::runtime_format(format));
+
+            ASSERT_EQ(contiguous.has_value(), generic.has_value());
+            if (!contiguous) {
+                EXPECT_EQ(contiguous.error().code(), generic.error().code());
+                continue;
+            }
+            const auto& a = contiguous->value();
+            const auto& b = generic->value();
+            EXPECT_EQ(a.subsec, b.subsec);
+            EXPECT_EQ(a.sec, b.sec);
+            EXPECT_EQ(a.min, b.min);
+            EXPECT_EQ(a.hour, b.hour);
+            EXPECT_EQ(a.mday, b.mday);
+            EXPECT_EQ(a.mon, b.mon);
+            EXPECT_EQ(a.year, b.year);
+            EXPECT_EQ(a.tz_offset, b.tz_offset);
+            EXPECT_EQ(contiguous->range().size(),
+                      static_cast<std::size_t>(
+                          std::distance(generic->begin(), source.end())));
+        }
+    }
 }
 
 TEST(ChronoScanTest, Fuzz1)
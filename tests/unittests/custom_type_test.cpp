@@ -128,6 +128,16 @@ TEST(CustomTypeTest,
     EXPECT_EQ(val, 0x123);
 }
 
+TEST(CustomTypeTest, WrappersWithCompiledFormatString)
+{
+    auto result = scn::scan<integer_wrapper, char_wrapper>(
+        "123 c", SCN_COMPILE("{:x} {}"));
+    ASSERT_TRUE(result);
+    auto [i, c] = result->values();
+    EXPECT_EQ(i.value, 0x123);
+    EXPECT_EQ(c.value, 'c');
+}
+
 // Wrapper over a variant,
 // with fully custom format string parsing
 struct variant_wrapper {
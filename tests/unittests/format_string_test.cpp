@@ -20,6 +20,8 @@
 #include <scn/scan.h>
 #include <scn/xchar.h>
 
+#include <deque>
+
 TEST(FormatStringTest, ConstructFromLiteral)
 {
     scn::scan_format_string<std::string_view, int> str{"{}"};
@@ -286,3 +288,103 @@ TEST(FormatStringTest, FuzzingError3)
     auto result = scn::scan<std::string>("{:G}", scn::runtime_format("{:G}"));
     ASSERT_FALSE(result);
 }
+
+TEST(FormatStringTest, CompiledSingleArgument)
+{
+    auto result = scn::scan<int>("42", SCN_COMPILE("{}"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 42);
+    EXPECT_TRUE(result->range().empty());
+}
+
+TEST(FormatStringTest, CompiledMultipleArguments)
+{
+    auto result = scn::scan<int, std::string, double>(
+        "42 foo 3.14 rest", SCN_COMPILE("{} {} {}"));
+    ASSERT_TRUE(result);
+    auto [i, s, d] = result->values();
+    EXPECT_EQ(i, 42);
+    EXPECT_EQ(s, "foo");
+    EXPECT_DOUBLE_EQ(d, 3.14);
+    EXPECT_EQ(std::string_view(result->range().data(), result->range().size()),
+              " rest");
+}
+
+TEST(FormatStringTest, CompiledWithSpecs)
+{
+    auto result = scn::scan<int, int, std::string>(
+        "ff:17abc", SCN_COMPILE("{:x}:{:o}{:.3c}"));
+    ASSERT_TRUE(result);
+    auto [a, b, s] = result->values();
+    EXPECT_EQ(a, 0xff);
+    EXPECT_EQ(b, 017);
+    EXPECT_EQ(s, "abc");
+}
+
+TEST(FormatStringTest, CompiledExplicitArgIds)
+{
+    auto result = scn::scan<int, int>("1 2", SCN_COMPILE("{1} {0}"));
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 1);
+}
+
+TEST(FormatStringTest, CompiledLiterals)
+{
+    auto result = scn::scan<int, int>("[1,   2]", SCN_COMPILE("[{},{}]"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(1, 2));
+    EXPECT_TRUE(result->range().empty());
+
+    result = scn::scan<int, int>("[1;2]", SCN_COMPILE("[{},{}]"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_literal);
+
+    result = scn::scan<int, int>("[1,2", SCN_COMPILE("[{},{}]"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_literal);
+}
+
+TEST(FormatStringTest, CompiledEscapedBraces)
+{
+    auto result = scn::scan<int>("{42}", SCN_COMPILE("{{{}}}"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 42);
+}
+
+TEST(FormatStringTest, CompiledInvalidValue)
+{
+    auto result = scn::scan<int>("foo", SCN_COMPILE("{}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(FormatStringTest, CompiledNonContiguousSource)
+{
+    std::deque<char> source{'1', ',', '2', ' ', 'x'};
+    auto result = scn::scan<int, int>(source, SCN_COMPILE("{},{}"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(1, 2));
+    EXPECT_EQ(*result->begin(), ' ');
+
+    result = scn::scan<int, int>(source, SCN_COMPILE("{};{}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_literal);
+}
+
+TEST(FormatStringTest, CompiledInitialValues)
+{
+    auto result = scn::scan<int, std::string>("42 foo", SCN_COMPILE("{} {}"),
+                                              {0, std::string{}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(42, std::string{"foo"}));
+}
+
+TEST(FormatStringTest, CompiledWide)
+{
+    auto result =
+        scn::scan<int, std::wstring>(L"42 foo", SCN_COMPILE(L"{} {}"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(42, std::wstring{L"foo"}));
+}
@@ -157,3 +157,36 @@ TEST(FindClassicNonspaceNarrowFastTest, EmojiInput)
             scn::impl::find_classic_nonspace_narrow_fast(input.substr(4))),
         input.data() + 5);
 }
+
+TEST(ValidateUtf8FastTest, Ascii)
+{
+    EXPECT_TRUE(scn::impl::validate_utf8_fast(""sv));
+    EXPECT_TRUE(scn::impl::validate_utf8_fast("foo"sv));
+    EXPECT_TRUE(scn::impl::validate_utf8_fast("foobarbazhelloworld123 foo"sv));
+}
+TEST(ValidateUtf8FastTest, ValidMultibyte)
+{
+    EXPECT_TRUE(scn::impl::validate_utf8_fast("ä"sv));
+    EXPECT_TRUE(scn::impl::validate_utf8_fast("abcdefgä😀hijklmnop"sv));
+    EXPECT_TRUE(scn::impl::validate_utf8_fast("ጉሮሮ ላይ ጋ sample plain-text"sv));
+}
+TEST(ValidateUtf8FastTest, Invalid)
+{
+    EXPECT_FALSE(scn::impl::validate_utf8_fast("\x80"sv));
+    EXPECT_FALSE(scn::impl::validate_utf8_fast("abcdefgh\xc3"sv));
+    EXPECT_FALSE(scn::impl::validate_utf8_fast("abcdefg\xe1\x88hijklmnop"sv));
+    EXPECT_FALSE(scn::impl::validate_utf8_fast("abc\xf8\x88\x80\x80 defgh"sv));
+}
+TEST(ValidateUtf8FastTest, MatchesScalar)
+{
+    auto src =
+        "\360,l\377\377\377\377\377\377\377\377ን ጉሮሮ ?T  ላU\213\230\263\255\341\341ጋed sample plain-te\341\213\265\341"sv;
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        for (std::size_t n = 0; i + n <= src.size(); ++n) {
+            auto sub = src.substr(i, n);
+            EXPECT_EQ(scn::impl::validate_utf8_fast(sub),
+                      scn::impl::validate_unicode_scalar(sub))
+                << i << " " << n;
+        }
+    }
+}
@@ -38,6 +38,29 @@ TEST(CalculateTextWidthTest, EmojiWidth)
     EXPECT_EQ(scn::impl::calculate_valid_text_width("😀"sv), 2);
 }
 
+TEST(CalculateTextWidthTest, EastAsianWide)
+{
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x1100}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x10ff}), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x3042}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x303f}), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x6f22}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0xac00}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0xff21}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0xff61}), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x1f680}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x20000}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x3fffd}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0xe0001}), 1);
+    EXPECT_EQ(scn::impl::calculate_valid_text_width("漢字かな"sv), 8);
+}
+TEST(CalculateTextWidthTest, ExtraWideRanges)
+{
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x4dc0}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x1f321}), 2);
+    EXPECT_EQ(scn::impl::calculate_text_width(char32_t{0x1f9ff}), 2);
+}
+
 TEST(TakeWidthViewTest, TakeAllSimpleCodePoints)
 {
     auto v = scn::impl::take_width("abc"sv, 3);
@@ -106,3 +106,43 @@ TEST(TranscodeTest, Unicode)
 
     EXPECT_EQ(narrowed, in);
 }
+
+TEST(TranscodeTest, Utf8ToUtf16)
+{
+    auto in = "abcdefghä😀ijk"sv;
+
+    std::u16string dest{};
+    scn::impl::transcode_to_string(in, dest);
+    EXPECT_EQ(dest, u"abcdefghä😀ijk");
+
+    dest.clear();
+    scn::impl::transcode_valid_to_string(in, dest);
+    EXPECT_EQ(dest, u"abcdefghä😀ijk");
+}
+
+TEST(TranscodeTest, Utf8ToUtf32)
+{
+    auto in = "abcdefghä😀ijk"sv;
+
+    std::u32string dest{};
+    scn::impl::transcode_to_string(in, dest);
+    EXPECT_EQ(dest, U"abcdefghä😀ijk");
+
+    dest.clear();
+    scn::impl::transcode_valid_to_string(in, dest);
+    EXPECT_EQ(dest, U"abcdefghä😀ijk");
+}
+
+TEST(TranscodeTest, InvalidUtf8ToUtf32)
+{
+    std::u32string dest{U"x"};
+    scn::impl::transcode_to_string("abcdefgh\xc3"sv, dest);
+    EXPECT_EQ(dest, U"xabcdefgh\xfffd");
+}
+
+TEST(TranscodeTest, Utf32ToUtf16)
+{
+    std::u16string dest{};
+    scn::impl::transcode_to_string(U"a😀"sv, dest);
+    EXPECT_EQ(dest, u"a😀");
+}
@@ -175,6 +175,28 @@ TEST(LocalizedChronoTest, MonthName)
 #endif
 }
 
+TEST(LocalizedChronoTest, NameConsumedWhole)
+{
+    auto result = scn::scan<std::tm>(std::locale::classic(), "Wednesday",
+                                     "{:L%a}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().tm_wday, 3);
+    EXPECT_TRUE(result->range().empty());
+
+    result = scn::scan<std::tm>(std::locale::classic(), "wed 12:30",
+                                "{:L%a %H:%M}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().tm_wday, 3);
+    EXPECT_EQ(result->value().tm_hour, 12);
+
+#if !SCN_STDLIB_LIBCPP
+    result = scn::scan<std::tm>(fi_locale, "keskiviikko", "{:L%A}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().tm_wday, 3);
+    EXPECT_TRUE(result->range().empty());
+#endif
+}
+
 TEST(LocalizedChronoTest, MonthDec)
 {
     auto result = scn::scan<std::tm>(std::locale::classic(), "2", "{:L%m}");
@@ -17,8 +17,47 @@
 
 #include "wrapped_gtest.h"
 
+#include <scn/regex.h>
 #include <scn/scan.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+#include <regex>
+#endif
+
+namespace {
+std::atomic<std::size_t> allocation_count{0};
+
+// Number of calls to the global operator new during `f()`
+template <typename F>
+std::size_t count_allocations(F&& f)
+{
+    const auto before = allocation_count.load();
+    f();
+    return allocation_count.load() - before;
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+    if (auto p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
 TEST(ToAddressTest, Pointer)
 {
     auto i = 42;
@@ -45,3 +84,88 @@ TEST(ToAddressTest, StringViewIterator)
     EXPECT_EQ(p, sv.data());
     EXPECT_EQ(*p, '4');
 }
+
+namespace {
+template <std::size_t>
+using int_for_index = int;
+
+template <std::size_t... I>
+void check_wide_row_does_not_allocate(std::index_sequence<I...>)
+{
+    std::string source{}, format{};
+    for (std::size_t i = 0; i < sizeof...(I); ++i) {
+        source += "1 ";
+        format += "{} ";
+    }
+
+    // The first scan may initialize global state, only look at the second
+    bool ok = false;
+    std::size_t allocations = 0;
+    for (int i = 0; i < 2; ++i) {
+        allocations = count_allocations([&]() {
+            auto result = scn::scan<int_for_index<I>...>(
+                source, scn::runtime_format(format));
+            ok = static_cast<bool>(result);
+        });
+    }
+    EXPECT_TRUE(ok) << sizeof...(I);
+    EXPECT_EQ(allocations, 0u) << sizeof...(I);
+}
+}  // namespace
+
+TEST(AllocationTest, WideRow)
+{
+    check_wide_row_does_not_allocate(std::make_index_sequence<64>{});
+    check_wide_row_does_not_allocate(std::make_index_sequence<65>{});
+    check_wide_row_does_not_allocate(std::make_index_sequence<256>{});
+}
+
+#if !SCN_DISABLE_REGEX
+
+namespace {
+// Allocations made by the second call to `f`,
+// the first one may initialize caches
+template <typename F>
+std::size_t count_repeated_allocations(F&& f)
+{
+    f();
+    return count_allocations(f);
+}
+}  // namespace
+
+TEST(AllocationTest, RegexMatches)
+{
+    const auto source = std::string_view{"2024-09-10 INFO started"};
+
+    bool ok = false;
+    const auto allocations = count_repeated_allocations([&]() {
+        auto result = scn::scan<scn::regex_matches>(
+            source, "{:/([0-9-]+) ([A-Z]+) ([a-z]+)/}");
+        ok = result && result->value().size() == 4;
+    });
+    EXPECT_TRUE(ok);
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+    // std::regex_search allocates its own state on every call,
+    // capturing the groups must not allocate anything more than that
+    const auto re = std::regex{"([0-9-]+) ([A-Z]+) ([a-z]+)"};
+    std::cmatch matches{};
+    const auto backend_allocations = count_repeated_allocations([&]() {
+        std::regex_search(source.data(), source.data() + source.size(),
+                          matches, re, std::regex_constants::match_continuous);
+    });
+    EXPECT_EQ(allocations, backend_allocations);
+#else
+    // The backend may allocate its own state on every match,
+    // capturing the groups must not allocate anything more than that
+    const auto match_allocations = count_repeated_allocations([&]() {
+        auto result = scn::scan<std::string_view>(
+            source, "{:/([0-9-]+) ([A-Z]+) ([a-z]+)/}");
+        ok = static_cast<bool>(result);
+    });
+    EXPECT_TRUE(ok);
+    EXPECT_LE(allocations, match_allocations);
+#endif
+}
+
+#endif  // !SCN_DISABLE_REGEX
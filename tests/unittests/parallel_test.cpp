@@ -0,0 +1,224 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/parallel.h>
+#include <scn/ranges.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// Split even small sources into chunks
+constexpr scn::scan_parallel_options four_threads{4, 1};
+
+std::string make_rows(int count)
+{
+    std::string source;
+    for (int i = 0; i < count; ++i) {
+        source += std::to_string(i);
+        source += i % 7 == 3 ? " x\n" : " 1.5\r\n";
+    }
+    return source;
+}
+}  // namespace
+
+TEST(ParallelTest, SplitIntoLineChunks)
+{
+    std::string_view source{"aa\nbb\ncc\ndd"};
+    auto chunks = scn::detail::split_source_into_line_chunks(source, 3);
+    EXPECT_THAT(chunks, testing::ElementsAre("aa\n", "bb\n", "cc\ndd"));
+
+    chunks = scn::detail::split_source_into_line_chunks(source, 8);
+    EXPECT_THAT(chunks, testing::ElementsAre("aa\n", "bb\n", "cc\n", "dd"));
+
+    chunks = scn::detail::split_source_into_line_chunks(
+        std::string_view{"abcdef"}, 4);
+    EXPECT_THAT(chunks, testing::ElementsAre("abcdef"));
+}
+
+TEST(ParallelTest, ScanColumnsSameAsSequential)
+{
+    auto fmt = scn::make_parsed_format<int, double>("{} {}");
+    ASSERT_TRUE(fmt);
+    const auto source = make_rows(1000);
+
+    std::vector<int> ids, expected_ids;
+    std::vector<double> values, expected_values;
+    auto result =
+        scn::scan_columns_parallel(four_threads, source, *fmt, ids, values);
+    auto expected =
+        scn::scan_columns(source, *fmt, expected_ids, expected_values);
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(expected);
+
+    EXPECT_EQ(result->rows, expected->rows);
+    EXPECT_EQ(result->consumed, source.size());
+    EXPECT_EQ(ids, expected_ids);
+    EXPECT_EQ(values, expected_values);
+    ASSERT_EQ(result->errors.size(), expected->errors.size());
+    for (std::size_t i = 0; i < result->errors.size(); ++i) {
+        EXPECT_EQ(result->errors[i].row, expected->errors[i].row);
+    }
+}
+
+TEST(ParallelTest, ScanColumnsSmallSourceOnOneThread)
+{
+    auto fmt = scn::make_parsed_format<int>("{}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> column;
+    auto result = scn::scan_columns_parallel("1\n2\n3", *fmt, column);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 3);
+    EXPECT_THAT(column, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(ParallelTest, ScanColumnsFixedCapacity)
+{
+    auto fmt = scn::make_parsed_format<int, double>("{} {}");
+    ASSERT_TRUE(fmt);
+    const auto source = make_rows(100);
+
+    int id_buffer[50]{};
+    double value_buffer[50]{};
+    auto ids = scn::span_out{id_buffer};
+    auto values = scn::span_out{value_buffer};
+    auto result =
+        scn::scan_columns_parallel(four_threads, source, *fmt, ids, values);
+
+    int expected_id_buffer[50]{};
+    double expected_value_buffer[50]{};
+    auto expected_ids = scn::span_out{expected_id_buffer};
+    auto expected_values = scn::span_out{expected_value_buffer};
+    auto expected =
+        scn::scan_columns(source, *fmt, expected_ids, expected_values);
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(expected);
+
+    EXPECT_EQ(result->rows, 50);
+    EXPECT_EQ(result->consumed, expected->consumed);
+    EXPECT_EQ(result->errors.size(), expected->errors.size());
+    EXPECT_TRUE(std::equal(std::begin(id_buffer), std::end(id_buffer),
+                           std::begin(expected_id_buffer)));
+}
+
+TEST(ParallelTest, ScanColumnsFilledByChunk)
+{
+    auto fmt = scn::make_parsed_format<int>("{}");
+    ASSERT_TRUE(fmt);
+    const std::string_view source{"1\nx\n2\n3\n"};
+    constexpr scn::scan_parallel_options two_threads{2, 1};
+
+    int buffer[1]{};
+    auto column = scn::span_out{buffer};
+    auto result =
+        scn::scan_columns_parallel(two_threads, source, *fmt, column);
+
+    int expected_buffer[1]{};
+    auto expected_column = scn::span_out{expected_buffer};
+    auto expected = scn::scan_columns(source, *fmt, expected_column);
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(expected);
+
+    EXPECT_EQ(result->rows, 1);
+    EXPECT_EQ(result->consumed, expected->consumed);
+    EXPECT_EQ(result->errors.size(), expected->errors.size());
+    EXPECT_EQ(buffer[0], 1);
+}
+
+TEST(ParallelTest, ScanColumnsSameValueTypes)
+{
+    auto fmt = scn::make_parsed_format<int, int>("{} {}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> a, b;
+    auto result = scn::scan_columns_parallel(four_threads, "1 2\n3 4\n5 6",
+                                             *fmt, a, b);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 3);
+    EXPECT_THAT(a, testing::ElementsAre(1, 3, 5));
+    EXPECT_THAT(b, testing::ElementsAre(2, 4, 6));
+}
+
+TEST(ParallelTest, ScanColumnsMismatchingTypes)
+{
+    auto fmt = scn::make_parsed_format<int>("{}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<double> column;
+    auto result =
+        scn::scan_columns_parallel(four_threads, make_rows(10), *fmt, column);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(ParallelTest, ScanColumnsWide)
+{
+    auto fmt = scn::make_parsed_format<int>(L"{}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> column;
+    auto result = scn::scan_columns_parallel(four_threads, L"1\n2\n3\n4\n5",
+                                             *fmt, column);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 5);
+    EXPECT_THAT(column, testing::ElementsAre(1, 2, 3, 4, 5));
+}
+
+TEST(ParallelTest, ForEachLine)
+{
+    const auto source = make_rows(1000);
+
+    std::atomic<int> lines{0};
+    std::atomic<long long> sum{0};
+    scn::for_each_line_parallel(
+        source,
+        [&](std::string_view line) {
+            ++lines;
+            EXPECT_TRUE(line.empty() || line.back() != '\r');
+            if (auto r = scn::scan<int>(line, "{}")) {
+                sum += r->value();
+            }
+        },
+        four_threads);
+    EXPECT_EQ(lines, 1000);
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+#if SCN_HAS_EXCEPTIONS
+TEST(ParallelTest, ForEachLineRethrows)
+{
+    const auto source = make_rows(1000);
+
+    std::atomic<int> lines{0};
+    EXPECT_THROW(scn::for_each_line_parallel(
+                     source,
+                     [&](std::string_view line) {
+                         ++lines;
+                         if (line.rfind("500 ", 0) == 0) {
+                             throw std::runtime_error{"500"};
+                         }
+                     },
+                     four_threads),
+                 std::runtime_error);
+    EXPECT_GT(lines, 0);
+}
+#endif
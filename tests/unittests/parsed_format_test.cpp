@@ -0,0 +1,244 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/parsed_format.h>
+#include <scn/ranges.h>
+
+#include <deque>
+#include <vector>
+
+TEST(ParsedFormatTest, Simple)
+{
+    auto fmt = scn::make_parsed_format<int>("{}");
+    ASSERT_TRUE(fmt);
+    EXPECT_EQ(fmt->get(), "{}");
+
+    auto result = scn::scan<int>("42", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 42);
+    EXPECT_TRUE(result->range().empty());
+}
+
+TEST(ParsedFormatTest, ReusedForMultipleScans)
+{
+    auto fmt = scn::make_parsed_format<int, std::string>("{:x}: {}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan<int, std::string>("ff: foo", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(0xff, std::string{"foo"}));
+
+    result = scn::scan<int, std::string>("10:bar", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(0x10, std::string{"bar"}));
+
+    result = scn::scan<int, std::string>("10;bar", *fmt);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_literal);
+}
+
+TEST(ParsedFormatTest, OutlivesFormatString)
+{
+    auto fmt = [] {
+        std::string str{"[{:[a-z]}]"};
+        return scn::make_parsed_format<std::string>(str);
+    }();
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan<std::string>("[abc]", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "abc");
+
+    auto copy = *fmt;
+    result = scn::scan<std::string>("[def1]", copy);
+    ASSERT_FALSE(result);
+}
+
+TEST(ParsedFormatTest, ExplicitArgIds)
+{
+    auto fmt = scn::make_parsed_format<int, int>("{1} {0}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan<int, int>("1 2", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(2, 1));
+}
+
+TEST(ParsedFormatTest, InvalidFormatString)
+{
+    auto fmt = scn::make_parsed_format<int>("{");
+    ASSERT_FALSE(fmt);
+    EXPECT_EQ(fmt.error().code(), scn::scan_error::invalid_format_string);
+
+    fmt = scn::make_parsed_format<int>("{:q}");
+    ASSERT_FALSE(fmt);
+    EXPECT_EQ(fmt.error().code(), scn::scan_error::invalid_format_string);
+
+    fmt = scn::make_parsed_format<int>("{} {}");
+    ASSERT_FALSE(fmt);
+    EXPECT_EQ(fmt.error().code(), scn::scan_error::invalid_format_string);
+
+    fmt = scn::make_parsed_format<int>("");
+    ASSERT_FALSE(fmt);
+    EXPECT_EQ(fmt.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(ParsedFormatTest, MismatchingArgumentTypes)
+{
+    auto fmt = scn::make_parsed_format<int>("{}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan<double>("42", *fmt);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+
+    auto result2 = scn::scan<int, int>("42", *fmt);
+    ASSERT_FALSE(result2);
+    EXPECT_EQ(result2.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(ParsedFormatTest, NonContiguousSource)
+{
+    auto fmt = scn::make_parsed_format<int, int>("{},{}");
+    ASSERT_TRUE(fmt);
+
+    auto source = std::deque<char>{'1', ',', '2', ' '};
+    auto result = scn::scan<int, int>(source, *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(1, 2));
+    EXPECT_EQ(*result->begin(), ' ');
+}
+
+namespace {
+struct wrapped_int {
+    int value{};
+};
+}  // namespace
+
+template <>
+struct scn::scanner<wrapped_int, char> : scn::scanner<int, char> {
+    template <typename Context>
+    auto scan(wrapped_int& val, Context& ctx) const
+        -> scn::scan_expected<typename Context::iterator>
+    {
+        return scn::scanner<int, char>::scan(val.value, ctx);
+    }
+};
+
+TEST(ParsedFormatTest, CustomType)
+{
+    auto fmt = scn::make_parsed_format<wrapped_int, wrapped_int>("{:x}/{}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan<wrapped_int, wrapped_int>("ff/10", *fmt);
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a.value, 0xff);
+    EXPECT_EQ(b.value, 10);
+
+    fmt = scn::make_parsed_format<wrapped_int>("{:x");
+    ASSERT_FALSE(fmt);
+}
+
+TEST(ParsedFormatTest, Wide)
+{
+    auto fmt = scn::make_parsed_format<int, std::wstring>(L"{} {}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan<int, std::wstring>(L"42 foo", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(42, std::wstring{L"foo"}));
+}
+
+TEST(ParsedFormatTest, ScanColumns)
+{
+    auto fmt = scn::make_parsed_format<int, std::string, double>("{} {} {}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    std::vector<double> values;
+    auto result = scn::scan_columns("1 foo 1.5\n2 bar 2.5\r\n3 baz 3.5\n",
+                                    *fmt, ids, names, values);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 3);
+    EXPECT_TRUE(result->errors.empty());
+    EXPECT_THAT(ids, testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT(names, testing::ElementsAre("foo", "bar", "baz"));
+    EXPECT_THAT(values, testing::ElementsAre(1.5, 2.5, 3.5));
+}
+
+TEST(ParsedFormatTest, ScanColumnsWithErrors)
+{
+    auto fmt = scn::make_parsed_format<int, int>("{},{}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> a{0}, b{0};
+    auto result = scn::scan_columns("1,2\nfoo\n\n3,4", *fmt, a, b);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 2);
+    ASSERT_EQ(result->errors.size(), 2);
+    EXPECT_EQ(result->errors[0].row, 1);
+    EXPECT_EQ(result->errors[0].error.code(),
+              scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result->errors[1].row, 2);
+    EXPECT_THAT(a, testing::ElementsAre(0, 1, 3));
+    EXPECT_THAT(b, testing::ElementsAre(0, 2, 4));
+}
+
+TEST(ParsedFormatTest, ScanColumnsMismatchingTypes)
+{
+    auto fmt = scn::make_parsed_format<int, int>("{} {}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> a;
+    std::vector<double> b;
+    auto result = scn::scan_columns("1 2", *fmt, a, b);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(ParsedFormatTest, ScanColumnsWide)
+{
+    auto fmt = scn::make_parsed_format<int, std::wstring>(L"{} {}");
+    ASSERT_TRUE(fmt);
+
+    std::vector<int> ids;
+    std::vector<std::wstring> names;
+    auto result = scn::scan_columns(L"1 foo\n2 bar", *fmt, ids, names);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 2);
+    EXPECT_EQ(result->consumed, 11);
+    EXPECT_THAT(ids, testing::ElementsAre(1, 2));
+    EXPECT_THAT(names, testing::ElementsAre(L"foo", L"bar"));
+}
+
+TEST(ParsedFormatTest, ScanColumnsIntoSpans)
+{
+    auto fmt = scn::make_parsed_format<int>("{}");
+    ASSERT_TRUE(fmt);
+
+    int buf[2]{};
+    auto column = scn::span_out<int>{buf};
+    auto result = scn::scan_columns("1\n2\n3\n", *fmt, column);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->rows, 2);
+    EXPECT_EQ(result->consumed, 4);
+    EXPECT_THAT(column, testing::ElementsAre(1, 2));
+}
@@ -17,8 +17,13 @@
 
 #include "wrapped_gtest.h"
 
+#include <algorithm>
+#include <array>
 #include <map>
+#include <memory>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <scn/ranges.h>
@@ -34,6 +39,169 @@ TEST(RangesTest, VectorSequence)
     EXPECT_THAT(result->value(), testing::ElementsAre(123, 456));
 }
 
+TEST(RangesTest, EmptyVector)
+{
+    auto result = scn::scan<std::vector<int>>("[ ]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->value().empty());
+    EXPECT_TRUE(result->range().empty());
+}
+
+TEST(RangesTest, VectorWithRest)
+{
+    auto result = scn::scan<std::vector<int>>("[1,2 , 3] 4", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre(1, 2, 3));
+    EXPECT_EQ(result->range().size(), 2);
+}
+
+TEST(RangesTest, VectorInvalid)
+{
+    auto result = scn::scan<std::vector<int>>("[1, 2 3]", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result = scn::scan<std::vector<int>>("[1, 2,]", "{}");
+    ASSERT_FALSE(result);
+
+    result = scn::scan<std::vector<int>>("[1, 2", "{}");
+    ASSERT_FALSE(result);
+}
+
+namespace {
+// Counts the allocations made through it
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++allocation_count;
+        largest_allocation = std::max(largest_allocation, n);
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, std::size_t n)
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&)
+    {
+        return true;
+    }
+    friend bool operator!=(const counting_allocator&, const counting_allocator&)
+    {
+        return false;
+    }
+
+    static inline int allocation_count{0};
+    static inline std::size_t largest_allocation{0};
+};
+}  // namespace
+
+TEST(RangesTest, LargeVector)
+{
+    std::string source{"["};
+    for (int i = 0; i < 1000; ++i) {
+        source += std::to_string(i);
+        source += ',';
+    }
+    source.back() = ']';
+
+    using vector_type = std::vector<int, counting_allocator<int>>;
+    counting_allocator<int>::allocation_count = 0;
+    auto result = scn::scan<vector_type>(source, "{}");
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->value().size(), 1000);
+    EXPECT_EQ(result->value().front(), 0);
+    EXPECT_EQ(result->value().back(), 999);
+    // Reserved up front, not grown element by element
+    EXPECT_EQ(counting_allocator<int>::allocation_count, 1);
+}
+
+TEST(RangesTest, ReserveIsBounded)
+{
+    // Lots of separators, but only the first element is valid
+    std::string source{"[x"};
+    source.append(1000000, ',');
+    source += ']';
+
+    using vector_type =
+        std::vector<std::string, counting_allocator<std::string>>;
+    counting_allocator<std::string>::largest_allocation = 0;
+    auto result = scn::scan<vector_type>(source, "{}");
+    ASSERT_FALSE(result);
+    EXPECT_LE(counting_allocator<std::string>::largest_allocation, 4096u);
+}
+
+TEST(RangesTest, NestedVector)
+{
+    auto result =
+        scn::scan<std::vector<std::vector<int>>>("[[1, 2], [], [3]]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(testing::ElementsAre(1, 2),
+                                     testing::IsEmpty(),
+                                     testing::ElementsAre(3)));
+}
+
+TEST(RangesTest, Array)
+{
+    auto result = scn::scan<std::array<int, 3>>("[1, 2, 3]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre(1, 2, 3));
+
+    result = scn::scan<std::array<int, 3>>("[1, 2]", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result = scn::scan<std::array<int, 3>>("[1, 2, 3, 4]", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result = scn::scan<std::array<int, 3>>("[]", "{}");
+    ASSERT_FALSE(result);
+
+    auto empty_result = scn::scan<std::array<int, 0>>("[]", "{}");
+    ASSERT_TRUE(empty_result);
+}
+
+TEST(RangesTest, SpanOut)
+{
+    int buf[4]{};
+    auto result = scn::scan<scn::span_out<int>>("[1, 2, 3] 4", "{}",
+                                                {scn::span_out<int>{buf}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().data(), buf);
+    EXPECT_EQ(result->value().capacity(), 4);
+    EXPECT_THAT(result->value(), testing::ElementsAre(1, 2, 3));
+    EXPECT_EQ(result->range().size(), 2);
+}
+
+TEST(RangesTest, SpanOutFull)
+{
+    std::array<double, 2> buf{};
+    auto result = scn::scan<scn::span_out<double>>(
+        "[1.5, 2.5]", "{}", {scn::span_out<double>{buf}});
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre(1.5, 2.5));
+}
+
+TEST(RangesTest, SpanOutOverflow)
+{
+    int buf[2]{};
+    auto result = scn::scan<scn::span_out<int>>("[1, 2, 3]", "{}",
+                                                {scn::span_out<int>{buf}});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
 TEST(RangesTest, Set)
 {
     static_assert(scn::range_format_kind<std::set<int>, char>::value ==
@@ -54,3 +222,67 @@ TEST(RangesTest, Map)
     EXPECT_THAT(result->value(),
                 testing::ElementsAre(std::pair{12, 34}, std::pair{56, 78}));
 }
+
+TEST(RangesTest, UnorderedMap)
+{
+    auto result =
+        scn::scan<std::unordered_map<int, int>>("{12: 34, 56: 78}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::UnorderedElementsAre(std::pair{12, 34},
+                                              std::pair{56, 78}));
+}
+
+TEST(RangesTest, MapDuplicateKeys)
+{
+    auto result = scn::scan<std::map<int, int>>("{1: 2, 3: 4, 1: 5}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(std::pair{1, 2}, std::pair{3, 4}));
+}
+
+namespace {
+template <scn::duplicate_key_policy Policy>
+struct policy_map : std::map<int, int> {};
+}  // namespace
+
+// Scanned with the custom scanner below, instead of the default one
+template <scn::duplicate_key_policy Policy>
+struct scn::range_format_kind<policy_map<Policy>, char>
+    : std::integral_constant<scn::range_format, scn::range_format::disabled> {
+};
+
+template <scn::duplicate_key_policy Policy>
+struct scn::scanner<policy_map<Policy>, char>
+    : scn::range_scanner<std::pair<int, int>, char> {
+    scanner()
+    {
+        this->set_brackets("{", "}");
+        this->base().set_brackets({}, {});
+        this->base().set_separator(":");
+        this->set_duplicate_key_policy(Policy);
+    }
+};
+
+TEST(RangesTest, MapDuplicateKeysKeepLast)
+{
+    auto result = scn::scan<policy_map<scn::duplicate_key_policy::keep_last>>(
+        "{1: 2, 3: 4, 1: 5}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(std::pair{1, 5}, std::pair{3, 4}));
+}
+
+TEST(RangesTest, MapDuplicateKeysReject)
+{
+    auto result = scn::scan<policy_map<scn::duplicate_key_policy::reject>>(
+        "{1: 2, 3: 4, 1: 5}", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result = scn::scan<policy_map<scn::duplicate_key_policy::reject>>(
+        "{1: 2, 3: 4}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(std::pair{1, 2}, std::pair{3, 4}));
+}
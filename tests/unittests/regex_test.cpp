@@ -23,6 +23,10 @@
 
 #include <deque>
 
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+#include <regex>
+#endif
+
 using namespace std::string_view_literals;
 
 #if !SCN_DISABLE_REGEX
@@ -89,6 +93,54 @@ TEST(RegexTest, Matches)
                 regex_matches_are<char>({"foobar123", "foobar", "123"}));
 }
 
+TEST(RegexTest, MatchesWithManyGroups)
+{
+    // More groups than are stored inline in regex_matches
+    auto r = scn::scan<scn::regex_matches>(
+        "abcdefghijk", "{:/(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)(x)?(k)/}");
+    ASSERT_TRUE(r);
+    EXPECT_TRUE(r->range().empty());
+    EXPECT_EQ(r->value().size(), 13);
+    EXPECT_EQ(r->value()[0]->get(), "abcdefghijk");
+    EXPECT_EQ(r->value()[1]->get(), "a");
+    EXPECT_EQ(r->value()[10]->get(), "j");
+    EXPECT_FALSE(r->value()[11]);
+    EXPECT_EQ(r->value()[12]->get(), "k");
+}
+
+TEST(RegexTest, MatchesWithLongMatch)
+{
+    // Longer than the text stored inline in regex_matches
+    const auto source = std::string(200, 'a') + std::string(100, 'b');
+    auto r = scn::scan<scn::regex_matches>(source, "{:/(a+)(b+)/}");
+    ASSERT_TRUE(r);
+    EXPECT_TRUE(r->range().empty());
+    EXPECT_THAT(r->value(), regex_matches_are<char>({source, source.substr(0, 200),
+                                                     source.substr(200)}));
+}
+
+TEST(RegexTest, MatchesCopy)
+{
+    auto r =
+        scn::scan<scn::regex_matches>("foobar123", "{:/([a-zA-Z]+)([0-9]+)/}");
+    ASSERT_TRUE(r);
+
+    auto copy = r->value();
+    r->value().reset("x", 0);
+    EXPECT_THAT(r->value(), regex_matches_are<char>({"x"}));
+    EXPECT_THAT(copy, regex_matches_are<char>({"foobar123", "foobar", "123"}));
+}
+
+TEST(RegexTest, MatchesFromSubmatches)
+{
+    auto matches = scn::regex_matches{"foobar123", {{0, 6}, {6, 0}, {6, 3}}};
+    EXPECT_EQ(matches.size(), 4);
+    EXPECT_EQ(matches[0]->get(), "foobar123");
+    EXPECT_EQ(matches[1]->get(), "foobar");
+    EXPECT_FALSE(matches[2]);
+    EXPECT_EQ(matches[3]->get(), "123");
+}
+
 #if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
 TEST(RegexTest, NamedString)
 {
@@ -270,6 +322,61 @@ TEST(RegexTest, NoCaseAndNoCaptureFlagMatches)
     EXPECT_THAT(r->value(), regex_matches_are<char>({"FooBar123"}));
 }
 
+TEST(RegexTest, RepeatedPattern)
+{
+    for (int i = 0; i < 3; ++i) {
+        auto str = scn::scan<std::string_view>("foobar123", "{:/([a-z]+)/}");
+        ASSERT_TRUE(str);
+        EXPECT_EQ(str->value(), "foobar");
+
+        auto matches =
+            scn::scan<scn::regex_matches>("foobar123", "{:/([a-z]+)/}");
+        ASSERT_TRUE(matches);
+        EXPECT_THAT(matches->value(),
+                    regex_matches_are<char>({"foobar", "foobar"}));
+    }
+}
+
+TEST(RegexTest, RepeatedPatternWithDifferentFlags)
+{
+    auto r = scn::scan<std::string_view>("fooBar123", "{:/[a-z]+/}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "foo");
+
+    r = scn::scan<std::string_view>("fooBar123", "{:/[a-z]+/i}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "fooBar");
+
+    r = scn::scan<std::string_view>("fooBar123", "{:/[a-z]+/}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "foo");
+}
+
+TEST(RegexTest, ManyDifferentPatterns)
+{
+    // More patterns than fit in the regex cache at once
+    for (int round = 0; round < 2; ++round) {
+        for (int n = 1; n <= 40; ++n) {
+            auto pattern = "{:/[0-9]{" + std::to_string(n) + "}/}";
+            auto source = std::string(static_cast<std::size_t>(n) + 1, '7');
+            auto r = scn::scan<std::string_view>(
+                source, scn::runtime_format(pattern));
+            ASSERT_TRUE(r) << pattern;
+            EXPECT_EQ(r->value().size(), static_cast<std::size_t>(n))
+                << pattern;
+        }
+    }
+}
+
+TEST(RegexTest, RepeatedInvalidRegex)
+{
+    for (int i = 0; i < 2; ++i) {
+        auto r = scn::scan<std::string_view>("foobar123", "{:/[a/}");
+        ASSERT_FALSE(r);
+        EXPECT_EQ(r.error().code(), scn::scan_error::invalid_format_string);
+    }
+}
+
 TEST(RegexTest, EscapedSlashInPattern)
 {
     auto r = scn::scan<std::string_view>("foo/bar", "{:/[a-z]+\\/[a-z]+/}");
@@ -299,6 +406,193 @@ TEST(RegexTest, NonContiguousSourceWithMatches)
     EXPECT_THAT(r->value(), regex_matches_are<char>({"Foo"}));
 }
 
+TEST(RegexTest, NonContiguousSourceLongMatch)
+{
+    const auto str = std::string(300, 'a') + "123 rest";
+    auto source = std::deque<char>(str.begin(), str.end());
+    auto r = scn::scan<std::string>(source, "{:/[a-z]+[0-9]+/}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), str.substr(0, 303));
+    EXPECT_EQ(std::distance(r->begin(), source.end()), 5);
+}
+
+TEST(RegexTest, NonContiguousSourceMatches)
+{
+    const auto str = std::string_view{"foo123 bar"};
+    auto source = std::deque<char>(str.begin(), str.end());
+    auto r = scn::scan<scn::regex_matches, std::string>(
+        source, "{:/([a-z]+)([0-9]+)/} {}");
+    ASSERT_TRUE(r);
+    auto [matches, rest] = r->values();
+    EXPECT_THAT(matches, regex_matches_are<char>({"foo123", "foo", "123"}));
+    EXPECT_EQ(rest, "bar");
+}
+
+TEST(RegexTest, NonContiguousSourceNoMatch)
+{
+    auto source = std::deque<char>(200, 'a');
+    auto r = scn::scan<std::string>(source, "{:/[a-z]+[0-9]+/}");
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+#endif
+
+namespace {
+constexpr bool is_ct_regex_supported(std::string_view pattern,
+                                     scn::detail::regex_flags flags =
+                                         scn::detail::regex_flags::none)
+{
+    return scn::detail::count_ct_regex_atoms(pattern, flags) != 0;
+}
+
+static_assert(is_ct_regex_supported("[a-z]+[0-9]{2,3}"));
+static_assert(is_ct_regex_supported("\\d+\\.\\d*"));
+static_assert(is_ct_regex_supported("[-_a-zA-Z\\d]{1,}x?"));
+static_assert(!is_ct_regex_supported("(foo)"));
+static_assert(!is_ct_regex_supported("foo|bar"));
+static_assert(!is_ct_regex_supported("^foo$"));
+static_assert(!is_ct_regex_supported("a+?"));
+static_assert(!is_ct_regex_supported("a{2"));
+static_assert(!is_ct_regex_supported("\\bfoo"));
+static_assert(!is_ct_regex_supported("[]"));
+static_assert(!is_ct_regex_supported("[z-a]"));
+// Would need backtracking
+static_assert(!is_ct_regex_supported("a*ab"));
+static_assert(!is_ct_regex_supported("a*a*a*b"));
+static_assert(!is_ct_regex_supported("\\w+\\s*\\w+"));
+static_assert(!is_ct_regex_supported("[a-z]+x?[a-z]"));
+static_assert(is_ct_regex_supported("a{2}a*b"));
+static_assert(is_ct_regex_supported("\\d+\\.?\\d*"));
+static_assert(is_ct_regex_supported("[a-z]+@[a-z]+\\.com"));
+
+template <typename T>
+void check_compiled_regex_result(const T& compiled, const T& runtime)
+{
+    ASSERT_EQ(compiled.has_value(), runtime.has_value());
+    if (compiled) {
+        EXPECT_EQ(compiled->value(), runtime->value());
+        EXPECT_EQ(compiled->range().size(), runtime->range().size());
+    }
+    else {
+        EXPECT_EQ(compiled.error().code(), runtime.error().code());
+    }
+}
+}  // namespace
+
+// Scans with both the compile-time regex engine and the regex backend
+#define CHECK_COMPILED_REGEX(T, source, format)                  \
+    check_compiled_regex_result(                                 \
+        scn::scan<T>(source, SCN_COMPILE(format)),               \
+        scn::scan<T>(source, scn::runtime_format(format)))
+
+TEST(RegexTest, CompiledRegex)
+{
+    CHECK_COMPILED_REGEX(std::string_view, "foobar123", "{:/[a-z]+/}");
+    CHECK_COMPILED_REGEX(std::string_view, "foobar123", "{:/[a-z]+\\d/}");
+    CHECK_COMPILED_REGEX(std::string_view, "foobar123", "{:/[0-9]+/}");
+    CHECK_COMPILED_REGEX(std::string_view, "FooBar123", "{:/[a-z]+/i}");
+    CHECK_COMPILED_REGEX(std::string_view, "FooBar123", "{:/[^a-z]+/i}");
+    CHECK_COMPILED_REGEX(std::string_view, "aaaab", "{:/a*ab/}");
+    CHECK_COMPILED_REGEX(std::string_view, "aaaab", "{:/a{2}a*b/}");
+    CHECK_COMPILED_REGEX(std::string_view, "ab@cd.com!",
+                         "{:/[a-z]+@[a-z]+\\.com/}");
+    CHECK_COMPILED_REGEX(std::string_view, "aaaab", "{:/a{2,3}/}");
+    CHECK_COMPILED_REGEX(std::string_view, "aaaab", "{:/a{5}/}");
+    CHECK_COMPILED_REGEX(std::string_view, "3.14 rest", "{:/\\d+\\.?\\d*/}");
+    CHECK_COMPILED_REGEX(std::string_view, "k_1-v x", "{:/[\\w-]+/}");
+    CHECK_COMPILED_REGEX(std::string_view, "a/b", "{:/a\\/b/}");
+    CHECK_COMPILED_REGEX(std::string_view, "123", "{:/[a-z]*/}");
+    CHECK_COMPILED_REGEX(std::string, "key: value\nnext", "{:/[^\\n]+/}");
+    CHECK_COMPILED_REGEX(std::string, "key: value\nnext", "{:/.+/}");
+    CHECK_COMPILED_REGEX(std::string, "k\u00e4y rest", "{:/.../}");
+    CHECK_COMPILED_REGEX(std::string, "k\u00e4y rest", "{:/\\S+/}");
+}
+
+TEST(RegexTest, CompiledRegexWithOtherFields)
+{
+    auto r = scn::scan<int, std::string_view, int>(
+        "1 key=2", SCN_COMPILE("{} {:/[a-z]+/}={}"));
+    ASSERT_TRUE(r);
+    EXPECT_TRUE(r->range().empty());
+    auto [a, key, b] = r->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(key, "key");
+    EXPECT_EQ(b, 2);
+}
+
+#if SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES
+TEST(RegexTest, CompiledRegexNonContiguousSource)
+{
+    auto source = std::deque<char>{'F', 'o', 'o', '4', '2'};
+    auto r = scn::scan<std::string>(source, SCN_COMPILE("{:/[a-zA-Z]+/}"));
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "Foo");
+}
+#endif
+
+TEST(RegexTest, RegexRefWithoutRegex)
+{
+    auto r = scn::scan<scn::regex_ref<std::string_view>>("foobar123", "{}");
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_format_string);
+}
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+
+TEST(RegexTest, RegexRefString)
+{
+    const auto re = std::regex{"[a-z]+"};
+    auto r = scn::scan<scn::regex_ref<std::string>>(
+        "foobar123", "{}", {scn::regex_ref<std::string>{re}});
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->range().size(), 3);
+    EXPECT_EQ(r->value().value(), "foobar");
+}
+
+TEST(RegexTest, RegexRefStringView)
+{
+    const auto re = std::regex{"[a-z]+", std::regex::icase};
+    auto r = scn::scan<int, scn::regex_ref<std::string_view>>(
+        "42 FooBar123", "{} {}", {0, scn::regex_ref<std::string_view>{re}});
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->range().size(), 3);
+    auto [i, str] = r->values();
+    EXPECT_EQ(i, 42);
+    EXPECT_EQ(str.value(), "FooBar");
+}
+
+TEST(RegexTest, RegexRefMatches)
+{
+    const auto re = std::regex{"([a-z]+)([0-9]+)"};
+    auto r = scn::scan<scn::regex_ref<scn::regex_matches>>(
+        "foobar123", "{}", {scn::regex_ref<scn::regex_matches>{re}});
+    ASSERT_TRUE(r);
+    EXPECT_TRUE(r->range().empty());
+    EXPECT_THAT(r->value().value(),
+                regex_matches_are<char>({"foobar123", "foobar", "123"}));
+}
+
+TEST(RegexTest, RegexRefNoMatch)
+{
+    const auto re = std::regex{"[a-z]+"};
+    auto r = scn::scan<scn::regex_ref<std::string_view>>(
+        "123foobar", "{}", {scn::regex_ref<std::string_view>{re}});
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(RegexTest, RegexRefWide)
+{
+    const auto re = std::wregex{L"([a-z]+)"};
+    auto r = scn::scan<scn::regex_ref<scn::wregex_matches>>(
+        L"foobar123", L"{}", {scn::regex_ref<scn::wregex_matches>{re}});
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->range().size(), 3);
+    EXPECT_THAT(r->value().value(),
+                regex_matches_are<wchar_t>({L"foobar", L"foobar"}));
+}
+
 #endif
 
 #endif  // !SCN_DISABLE_REGEX
@@ -259,3 +259,134 @@ TEST(ScanTest, Pointer)
     EXPECT_EQ(reinterpret_cast<uintptr_t>(a), 0xdeadbeef);
     EXPECT_EQ(reinterpret_cast<uintptr_t>(b), 0xABBAABBA);
 }
+
+TEST(ScanTest, WhitespaceSeparatedArguments)
+{
+    auto res = scn::scan<int, std::string, double>("1\t foo\n2.5 rest",
+                                                   "{}\n{}  {}");
+    ASSERT_TRUE(res);
+    auto [a, b, c] = res->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, "foo");
+    EXPECT_DOUBLE_EQ(c, 2.5);
+    EXPECT_STREQ(res->range().data(), " rest");
+}
+TEST(ScanTest, WhitespaceSeparatedArgumentsFromNonContiguousSource)
+{
+    auto source = std::deque<char>{'1', ' ', '2', ' ', 'x'};
+    auto res = scn::scan<int, int>(source, "{} {}");
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->values(), std::make_tuple(1, 2));
+    EXPECT_EQ(*res->begin(), ' ');
+}
+TEST(ScanTest, WhitespaceSeparatedArgumentsUnexpectedEnd)
+{
+    auto res = scn::scan<int, int>("1", "{} {}");
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code(), scn::scan_error::invalid_literal);
+
+    auto res2 = scn::scan<int, int>("1 2", "{} {} ");
+    ASSERT_FALSE(res2);
+    EXPECT_EQ(res2.error().code(), scn::scan_error::invalid_literal);
+}
+TEST(ScanTest, AdjacentArguments)
+{
+    auto res = scn::scan<int, char>("123abc", "{}{}");
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->values(), std::make_tuple(123, 'a'));
+    EXPECT_STREQ(res->range().data(), "bc");
+}
+
+TEST(ScanTest, LongLiteralPrefixes)
+{
+    auto res = scn::scan<int, std::string, std::string>(
+        "timestamp=123 level=info msg=hello", "timestamp={} level={} msg={}");
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->values(), std::make_tuple(123, "info", "hello"));
+    EXPECT_TRUE(res->range().empty());
+}
+TEST(ScanTest, LongLiteralPrefixesFromNonContiguousSource)
+{
+    auto source = std::deque<char>{};
+    for (char ch : std::string_view{"id=42;name=foo"}) {
+        source.push_back(ch);
+    }
+    auto res = scn::scan<int, std::string>(source, "id={};name={}");
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->values(), std::make_tuple(42, "foo"));
+}
+TEST(ScanTest, LongLiteralMismatch)
+{
+    auto res = scn::scan<int>("timestamp=123", "timestump={}");
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code(), scn::scan_error::invalid_literal);
+    EXPECT_STREQ(res.error().msg(), "Unexpected literal character in source");
+}
+TEST(ScanTest, LongLiteralMismatchInShortSource)
+{
+    auto res = scn::scan<int>("tx", "timestamp={}");
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code(), scn::scan_error::invalid_literal);
+    EXPECT_STREQ(res.error().msg(), "Unexpected literal character in source");
+}
+TEST(ScanTest, LongLiteralUnexpectedEnd)
+{
+    auto res = scn::scan<int>("time", "timestamp={}");
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code(), scn::scan_error::invalid_literal);
+    EXPECT_STREQ(res.error().msg(), "Unexpected end of source");
+}
+
+namespace {
+template <std::size_t>
+using int_for_index = int;
+
+template <std::size_t... I>
+auto scan_ints(std::string_view source,
+               const std::string& format,
+               std::index_sequence<I...>)
+{
+    return scn::scan<int_for_index<I>...>(source,
+                                          scn::runtime_format(format));
+}
+
+template <std::size_t N>
+void check_wide_row()
+{
+    std::string source{}, format{};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (i != 0) {
+            source += ',';
+            format += ',';
+        }
+        source += std::to_string(i);
+        format += "{}";
+    }
+
+    auto res = scan_ints(source, format, std::make_index_sequence<N>{});
+    ASSERT_TRUE(res) << N;
+    EXPECT_EQ(std::get<0>(res->values()), 0);
+    EXPECT_EQ(std::get<N - 1>(res->values()), static_cast<int>(N - 1));
+    EXPECT_TRUE(res->range().empty());
+}
+}  // namespace
+
+TEST(ScanTest, WideRows)
+{
+    check_wide_row<64>();
+    check_wide_row<65>();
+    check_wide_row<130>();
+}
+TEST(ScanTest, WideRowNotExhausted)
+{
+    std::string source{}, format{};
+    for (int i = 0; i < 99; ++i) {
+        source += "1,";
+        format += "{" + std::to_string(i) + "},";
+    }
+
+    auto res = scan_ints(source, format, std::make_index_sequence<100>{});
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error().code(), scn::scan_error::invalid_format_string);
+    EXPECT_STREQ(res.error().msg(), "Argument list not exhausted");
+}
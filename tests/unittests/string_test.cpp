@@ -147,6 +147,46 @@ TEST(StringTest, CharacterSetPresentationWideStringFromNarrowSource)
     EXPECT_EQ(result->value(), L"abc");
 }
 
+TEST(StringTest, CharacterSetPresentationNonAsciiOverlappingRanges)
+{
+    auto result = scn::scan<std::string>("äöåüx", "{:[ä-åå-üö]}");
+    ASSERT_TRUE(result);
+    EXPECT_STREQ(result->begin(), "x");
+    EXPECT_EQ(result->value(), "äöåü");
+}
+TEST(StringTest, CharacterSetPresentationNonAsciiRepeated)
+{
+    for (int i = 0; i < 2; ++i) {
+        auto result = scn::scan<std::string>("ääöx", "{:[ä]}");
+        ASSERT_TRUE(result);
+        EXPECT_STREQ(result->begin(), "öx");
+        EXPECT_EQ(result->value(), "ää");
+
+        auto wresult = scn::scan<std::wstring>(L"ääöx", L"{:[ä]}");
+        ASSERT_TRUE(wresult);
+        EXPECT_STREQ(wresult->begin(), L"öx");
+        EXPECT_EQ(wresult->value(), L"ää");
+
+        result = scn::scan<std::string>("öäx", "{:[ö]}");
+        ASSERT_TRUE(result);
+        EXPECT_STREQ(result->begin(), "äx");
+        EXPECT_EQ(result->value(), "ö");
+    }
+}
+TEST(StringTest, CharacterSetPresentationNonAsciiMultipleSets)
+{
+    for (int i = 0; i < 3; ++i) {
+        auto result = scn::scan<std::string, std::string, std::string>(
+            "ääö öö ååx", "{:[ä-ö]} {:[ö]} {:[å]}");
+        ASSERT_TRUE(result);
+        EXPECT_STREQ(result->begin(), "x");
+        auto [a, b, c] = result->values();
+        EXPECT_EQ(a, "ääö");
+        EXPECT_EQ(b, "öö");
+        EXPECT_EQ(c, "åå");
+    }
+}
+
 TEST(StringTest, WonkyInput)
 {
     const char source[] = {'o', ' ', '\x0f', '\n', '\n', '\xc3'};